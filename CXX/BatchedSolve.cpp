@@ -0,0 +1,198 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Batched Small Systems
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Solves many small systems Ax = b in a single launch (cl_batched.h)	*
+ * 	and compares it with launching once per system.						*
+ *																		*
+ * Usage: BatchedSolve [--batch N] [--n N] [--method jacobi|cg|lu]		*
+ * 					   [--tol T] [--loop N]								*
+ * 	System s is the 3 x 3 problem of Jacobi_Iteration generalised to n	*
+ * 	rows, tridiag(-1, d_s, -1) x = (200, 0, ..., 0, 400), with the		*
+ * 	diagonal d_s = 2 + 0.1 (s mod 8) varying over the batch. --loop		*
+ * 	sets how many systems the one-launch-per-system baseline solves.	*
+ ************************************************************************/
+
+#include "cl_batched.h"
+#include "cl_buffer_pool.h"
+#include "cl_runtime.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [0]:Command Line Options
+    int batch = 10000;
+    int n = 3;
+    int loop = 200;
+    clp::BatchOptions options;
+    options.tol = 1e-8;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--batch") == 0 && arg + 1 < argc)
+        {
+            batch = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--n") == 0 && arg + 1 < argc)
+        {
+            n = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--loop") == 0 && arg + 1 < argc)
+        {
+            loop = std::max(0, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--tol") == 0 && arg + 1 < argc)
+        {
+            options.tol = atof(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--method") == 0 && arg + 1 < argc)
+        {
+            arg++;
+            if (strcmp(argv[arg], "jacobi") == 0)
+            {
+                options.method = clp::BatchMethod::Jacobi;
+            }
+            else if (strcmp(argv[arg], "cg") == 0)
+            {
+                options.method = clp::BatchMethod::Cg;
+            }
+            else if (strcmp(argv[arg], "lu") == 0)
+            {
+                options.method = clp::BatchMethod::Lu;
+            }
+            else
+            {
+                fprintf(stderr, "Unknown method '%s', expected jacobi, cg or lu\n", argv[arg]);
+                return 1;
+            }  // end if
+        }
+        else
+        {
+            fprintf(stderr,
+                    "Usage: %s [--batch N] [--n N] [--method jacobi|cg|lu] [--tol T] [--loop N]\n",
+                    argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+    options.maxiter = std::max(options.maxiter, 20 * n * n);
+    loop = std::min(loop, batch);
+
+    // [A]:Problem Setup, systems packed back to back
+    const int nn = n * n;
+    std::vector<double> A(static_cast<size_t>(batch) * nn, 0.0);
+    std::vector<double> b(static_cast<size_t>(batch) * n, 0.0);
+    for (int s = 0; s < batch; s++)
+    {
+        double* As = A.data() + static_cast<size_t>(s) * nn;
+        for (int i = 0; i < n; i++)
+        {
+            As[i + n * i] = 2.0 + 0.1 * (s % 8);
+            if (i > 0)
+            {
+                As[(i - 1) + n * i] = -1.0;
+            }
+            if (i < n - 1)
+            {
+                As[(i + 1) + n * i] = -1.0;
+            }
+        }  // end i
+        b[static_cast<size_t>(s) * n] += 200;
+        b[static_cast<size_t>(s) * n + n - 1] += 400;
+    }  // end s
+
+    // [B]:Platform, Device, Context and Queue (see cl_runtime.h)
+    clp::Runtime& runtime = clp::Runtime::instance();
+    runtime.print_selection();
+    cl::CommandQueue& queue = runtime.queue();
+
+    clp::BatchedSolver solver(options);
+    printf("%d systems of size %d, method %s (largest n that fits: %d)\n",
+           batch,
+           n,
+           clp::batch_method_name(options.method),
+           solver.max_size());
+
+    // [C]:Whole batch in one launch
+    std::vector<double> x(static_cast<size_t>(batch) * n, 1.0);
+    clp::BatchResult result;
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        result = solver.solve(queue, n, batch, A.data(), nn, b.data(), n, x.data(), n);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    const double batch_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // [D]:Baseline: the first "loop" systems, one launch (and one set of
+    // 	buffers) each
+    std::vector<double> x_loop(static_cast<size_t>(loop) * n, 1.0);
+    start = std::chrono::steady_clock::now();
+    for (int s = 0; s < loop; s++)
+    {
+        solver.solve(queue,
+                     n,
+                     1,
+                     A.data() + static_cast<size_t>(s) * nn,
+                     nn,
+                     b.data() + static_cast<size_t>(s) * n,
+                     n,
+                     x_loop.data() + static_cast<size_t>(s) * n,
+                     n);
+    }  // end s
+    const double loop_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // [E]:Report
+    double worst = 0.0;
+    double difference = 0.0;
+    for (int s = 0; s < batch; s++)
+    {
+        worst = std::max(worst, result.residual[s]);
+    }  // end s
+    for (size_t i = 0; i < x_loop.size(); i++)
+    {
+        difference = std::max(difference, fabs(x_loop[i] - x[i]));
+    }  // end i
+    const int most_iterations = *std::max_element(result.iterations.begin(), result.iterations.end());
+
+    std::cout << "Code executed successfully!" << std::endl;
+    printf("Converged: %d / %d, most iterations = %d, worst residual = %e\n",
+           result.converged_count(),
+           batch,
+           most_iterations,
+           worst);
+    printf("One launch     : %10.4f s | %8.3f us per system\n", batch_seconds, 1e6 * batch_seconds / batch);
+    if (loop > 0)
+    {
+        printf("Launch/system  : %10.4f s | %8.3f us per system (%d systems, max |difference| = %e)\n",
+               loop_seconds,
+               1e6 * loop_seconds / loop,
+               loop,
+               difference);
+    }
+    clp::BufferPool::instance().print_stats();
+
+    // Display the first system
+    for (int i = 0; i < std::min(n, 16); i++)
+    {
+        std::cout << x[i] << std::endl;
+    }  // end i
+
+    return result.converged_count() == batch ? 0 : 1;
+
+}  // END program
@@ -0,0 +1,258 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Conjugate Gradient Method
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * This code solves systems in the form Ax = b with the preconditioned	*
+ * 	conjugate gradient method via OpenCL in C++ (see cl_cg_solver.h)	*
+ *																		*
+ * Usage: ConjugateGradient [--n N] [--format dense|csr|ell|stencil]	*
+ * 						    [--precond none|jacobi|mg] [--check-every N]	*
+ * 						    [--tol T] [--multi-device]					*
+ * 	Solves the same n x n 1-D Poisson system as Jacobi_Iteration,		*
+ * 	tridiag(-1, 2, -1) x = b with b = (200, 0, ..., 0, 400), and checks	*
+ * 	the answer against the exact solution, which is linear in i. The	*
+ * 	stencil format applies A without storing it (see cl_stencil.h); mg	*
+ * 	preconditions with one multigrid V-cycle (see cl_multigrid.h).		*
+ * 	--multi-device splits the CSR matrix into row blocks over every		*
+ * 	device of the platform and runs diagonally preconditioned CG on		*
+ * 	all of them, whatever --format and --precond say (see				*
+ * 	cl_multidevice.h). Without a usable OpenCL device (or with			*
+ * 	CLP_BACKEND=native) the same CG runs on the threaded host kernels	*
+ * 	of host_kernels.h.													*
+ ************************************************************************/
+
+#include "cl_buffer_pool.h"
+#include "cl_cg_solver.h"
+#include "cl_multidevice.h"
+#include "cl_multigrid.h"
+#include "cl_runtime.h"
+#include "cl_sparse.h"
+#include "cl_stencil.h"
+#include "host_kernels.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [0]:Command Line Options
+    const char* usage =
+        "Usage: %s [--n N] [--format dense|csr|ell|stencil] [--precond none|jacobi|mg] [--check-every N]\n"
+        "       [--tol T] [--multi-device]\n";
+    const char* format = "csr";      // Storage of A
+    const char* precond = "jacobi";  // none, Jacobi (diagonal) or multigrid
+    int ny = 1000;                   // System size
+    bool multi_device = false;       // Row blocks over every device (CSR)
+    clp::CgOptions options;
+    options.tol = 1e-8;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--n") == 0 && arg + 1 < argc)
+        {
+            ny = atoi(argv[++arg]);
+            if (ny < 2)
+            {
+                fprintf(stderr, "--n must be at least 2\n");
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--format") == 0 && arg + 1 < argc)
+        {
+            format = argv[++arg];
+            if (strcmp(format, "dense") != 0 && strcmp(format, "csr") != 0 && strcmp(format, "ell") != 0 &&
+                strcmp(format, "stencil") != 0)
+            {
+                fprintf(stderr, "Unknown format '%s', expected dense, csr, ell or stencil\n", format);
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--precond") == 0 && arg + 1 < argc)
+        {
+            precond = argv[++arg];
+            if (strcmp(precond, "none") != 0 && strcmp(precond, "jacobi") != 0 && strcmp(precond, "mg") != 0)
+            {
+                fprintf(stderr, "Unknown preconditioner '%s', expected none, jacobi or mg\n", precond);
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--multi-device") == 0)
+        {
+            multi_device = true;
+        }
+        else if (strcmp(argv[arg], "--check-every") == 0 && arg + 1 < argc)
+        {
+            options.check_every = atoi(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--tol") == 0 && arg + 1 < argc)
+        {
+            options.tol = atof(argv[++arg]);
+        }
+        else
+        {
+            fprintf(stderr, usage, argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+    options.maxiter = std::max(options.maxiter, 2 * ny);
+
+    // [A]:Problem Setup, for the OpenCL device or, without one, the
+    // 	native host backend (see cl_runtime.h)
+    clp::Backend backend = clp::Backend::OpenCL;
+    try
+    {
+        backend = clp::select_backend();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    const bool native = backend == clp::Backend::Native;
+    const bool matrix_free = !native && !multi_device && strcmp(format, "stencil") == 0;
+    clp::CsrMatrix A_csr = matrix_free ? clp::CsrMatrix() : clp::tridiagonal_csr(ny, -1, 2, -1);  // Left Hand Side
+    std::vector<double> b(ny, 0.0);                              // Right Hand Side
+    std::vector<double> x(ny, 1.0);                              // Initial Guess
+    b[0] = 200;
+    b[ny - 1] = 400;
+
+    clp::SolveResult result;
+    if (native)
+    {
+        // [B]:Threaded host CG on A_csr, diagonally preconditioned (see
+        // 	host_kernels.h)
+        printf("Backend: native, %d host threads, preconditioner: jacobi\n",
+               clp::host::ThreadPool::instance().size());
+        result = clp::host::cg_solve(A_csr, b, x, options);
+    }
+    else if (multi_device)
+    {
+        // [B]:Row blocks of A_csr, balanced by measured throughput (see
+        // 	cl_multidevice.h); the diagonal preconditioner is built in
+        try
+        {
+            clp::DeviceGroup group = clp::DeviceGroup::platform_devices();
+            group.print();
+            clp::DistributedCsr A_dist(group, A_csr);
+            A_dist.print_partition();
+            printf("Matrix format: csr (n = %d, nnz = %d) on %d devices, preconditioner: jacobi\n",
+                   ny,
+                   A_csr.nnz(),
+                   group.size());
+
+            // [C]:CG with a halo exchange before every product
+            result = clp::multi_device_cg(A_dist, b, x, options);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        // [B]:Platform, Device, Context and Queue (see cl_runtime.h)
+        clp::Runtime& runtime = clp::Runtime::instance();
+        runtime.print_selection();
+
+        const cl::Context& context = runtime.context();
+        cl::CommandQueue& queue = runtime.queue();
+
+        // [C]:Operator in the requested storage format
+        std::unique_ptr<clp::DeviceOperator> op;
+        std::unique_ptr<clp::Preconditioner> M;
+        try
+        {
+            if (matrix_free)
+            {
+                op.reset(new clp::StencilOperator<double>(ny));
+            }
+            else if (strcmp(format, "csr") == 0)
+            {
+                op.reset(new clp::CsrOperator<double>(A_csr));
+            }
+            else if (strcmp(format, "ell") == 0)
+            {
+                op.reset(new clp::EllOperator<double>(clp::ell_from_csr(A_csr)));
+            }
+            else
+            {
+                std::vector<double> A(static_cast<size_t>(ny) * ny, 0.0);
+                for (int row = 0; row < ny; row++)
+                {
+                    for (int k = A_csr.row_ptr[row]; k < A_csr.row_ptr[row + 1]; k++)
+                    {
+                        A[A_csr.col_idx[k] + static_cast<size_t>(ny) * row] = A_csr.values[k];
+                    }  // end k
+                }  // end row
+                op.reset(new clp::DenseOperator<double>(A.data(), ny));
+            }  // end if
+
+            if (strcmp(precond, "jacobi") == 0)
+            {
+                M.reset(new clp::JacobiPreconditioner(queue, *op));
+            }
+            else if (strcmp(precond, "mg") == 0)
+            {
+                M.reset(new clp::Multigrid(ny));
+            }  // end if
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        printf("Matrix format: %s (n = %d, nnz = %d), preconditioner: %s\n",
+               format,
+               ny,
+               A_csr.nnz(),
+               precond);
+
+        // [D]:Device Buffers and Solve
+        cl::Buffer b_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double) * ny, b.data());
+        cl::Buffer x_buf(context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(double) * ny, x.data());
+
+        clp::CgSolver solver(options);
+        result = solver.solve(queue, *op, b_buf, x_buf, M.get());
+
+        // [E]:Read back the solution once
+        queue.enqueueReadBuffer(x_buf, CL_TRUE, 0, sizeof(double) * ny, x.data());
+    }  // end if
+
+    // The exact solution of tridiag(-1, 2, -1) x = b is linear:
+    // 	x_i = 200 + 200 (i + 1) / (n + 1)
+    double max_error = 0.0;
+    int i;
+    for (i = 0; i < ny; i++)
+    {
+        const double exact = 200.0 + 200.0 * (i + 1) / (ny + 1);
+        max_error = std::max(max_error, fabs(x[i] - exact));
+    }  // end i
+
+    std::cout << "Code executed successfully!" << std::endl;
+    printf("Iterations: %d (%s), residual = %e, max |error| = %e\n",
+           result.iterations,
+           result.converged ? "converged" : "not converged",
+           result.residual,
+           max_error);
+    clp::BufferPool::instance().print_stats();
+
+    // Display Result
+    for (i = 0; i < std::min(ny, 16); i++)
+    {
+        std::cout << x[i] << std::endl;
+    }  // end i
+
+    return result.converged ? 0 : 1;
+
+}  // END program
@@ -1,255 +1,526 @@
 // Alejandro Valencia
 // OpenCL C++ Projects: Jacobi Method
 // Start: 22 June, 2019
-// Update: 22 June, 2019
+// Update: 18 October, 2026
 
 /************************************************************************
-* This code parallelizes the Jacobi Method of solving systems in the  	*
-* 	form Ax = b via OpenCL in C++ 										*
-************************************************************************/
-
-#define CL_HPP_ENABLE_EXCEPTIONS
-#define CL_HPP_TARGET_OPENCL_VERSION 200
-#define MAX_SOURCE_SIZE (0x100000)
-
+ * This code parallelizes the Jacobi Method of solving systems in the  	*
+ * 	form Ax = b via OpenCL in C++ 										*
+ *																		*
+ * Usage: Jacobi_Iteration [--legacy] [--check-every N] [--norm inf|2]	*
+ * 						   [--format dense|csr|ell|stencil] [--n N]		*
+ * 						   [--precision double|single|mixed] [--tol T]	*
+ * 						   [--method jacobi|gs|sor] [--omega W] [--2d]	*
+ * 						   [--multi-device] [--numa]					*
+ * 	Solves the n x n 1-D Poisson system tridiag(-1, 2, -1) x = b with	*
+ * 	b = (200, 0, ..., 0, 400); the default n = 3 is the original 3x3	*
+ * 	example. By default the solver runs device-resident (see			*
+ * 	cl_jacobi_solver.h) on the matrix stored in the chosen format, and	*
+ * 	only a scalar residual is read back every N iterations. The residual	*
+ * 	norm is reduced on the device (max norm by default, or the 2-norm).	*
+ * 	--legacy restores the original host-side loop on the dense matrix.	*
+ * 	--precision picks the device scalar (see cl_precision.h; default	*
+ * 	CLP_PRECISION): mixed runs fp32 inner solves under fp64 iterative	*
+ * 	refinement down to --tol. --method gs/sor sweeps the red-black		*
+ * 	colouring instead of Jacobi (SOR relaxed by --omega), and --2d		*
+ * 	solves the 5-point Poisson system of an n x n grid. The stencil		*
+ * 	format stores no matrix at all (see cl_stencil.h). --multi-device	*
+ * 	splits the CSR matrix into row blocks over every device of the		*
+ * 	platform (see cl_multidevice.h); it runs Jacobi in double precision	*
+ * 	whatever --format and --precision say. --numa does the same over	*
+ * 	the NUMA nodes of the selected CPU device, one sub-device each,		*
+ * 	with every block's memory placed on its own node.					*
+ *																		*
+ * 	Without a usable OpenCL device (or with CLP_BACKEND=native) the		*
+ * 	solve runs on the threaded host kernels of host_kernels.h instead:	*
+ * 	Jacobi on the CSR matrix, whatever the other options say.			*
+ ************************************************************************/
+
+#include "cl_buffer.h"
+#include "cl_buffer_pool.h"
+#include "cl_jacobi_solver.h"
+#include "cl_multidevice.h"
+#include "cl_precision.h"
+#include "cl_runtime.h"
+#include "cl_sparse.h"
+#include "cl_stencil.h"
+#include "host_kernels.h"
+#include "mylib.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
 #include <stdio.h>
 #include <stdlib.h>
-#include <CL/cl2.hpp>
-#include <iostream>
-#include "mylib.h"
+#include <string.h>
 
 /************************************************************************
-* Function Declarations 												*
-************************************************************************/
-
-	int print_platforms(int,std::vector<cl::Platform>);
-
-//end Function Declarations
-
+ * Function Declarations 												*
+ ************************************************************************/
+
+// Operator for A in the requested storage format, stored as Real; the
+// 	stencil format needs only the nx (x ny) grid
+template <typename Real>
+std::unique_ptr<clp::DeviceOperator> make_operator(const char* format,
+                                                   int nx,
+                                                   int ny,
+                                                   const clp::CsrMatrix& A_csr,
+                                                   const std::vector<double>& A);
+
+// Device-resident Jacobi in Real; x holds the initial guess and receives
+// 	the solution
+template <typename Real>
+clp::SolveResult solve_in(cl::CommandQueue& queue,
+                          clp::DeviceOperator& op,
+                          const std::vector<double>& b,
+                          std::vector<double>& x,
+                          const clp::JacobiOptions& options);
+
+// end Function Declarations
 
 /************************************************************************
-* Main Program 															*
-************************************************************************/
-
-int main(){
-	//printf("OpenCL C++ library found!\n");
-	//std::cout<<"C++ OpenCL ver 2 check" << std::endl;
-
-	cl_int err;
-
-	// [A]:Problem Setup
-	int nx = 9;
-	int ny = 3;
-	int maxiter = 1000;
-	double A[nx] = {2, -1, 0, -1, 2, -1, 0, -1, 2}; 	// Left Hand Side
-	double b[ny] = {200,0,400}; 				// Right Hand Side
-	double x[ny] = {1,1,1}; 					// Initial Guess
-	double xn[ny],RES[ny],tmp[ny];				// Solution Vector
-	double tol = 0.001;
-
-
-	// [B]:Create Platform Object
-	// Filter for a 2.0 platform and set it as the default
-    std::vector<cl::Platform> platforms; 		// Declare "platforms" as std type vector cl type Platform
-	cl::Platform::get(&platforms); 				// Using scope cd::Platform get all platforms and place in variable platforms
-
-	int  num_platforms = platforms.size(); 		// Use platform.size() to get number of platforms
-	std::cout<<"Number of Platforms: "
-			 <<num_platforms<<std::endl;   		// Print number of platforms
-
-
-	// [B.1]:Print Platform Atributions
-	//print_platforms(num_platforms,platforms);
-
-
-	// [C]:Get Devices for Said Platforms
-	// NOTE: During debugging, platform[0] is the "Intel CPU Compute Runtime",
-	// 	while platform[1] is named "Portable Computing Language"
-
-	auto platform = platforms[0];
-
-	std::vector<cl::Device> devices; 					// Declare "devices" as a std type vector cl type Device
-	err = platform.getDevices(CL_DEVICE_TYPE_ALL, &devices);	// Get ALL devices associated with Intel CPU Runtime
-	std::cout<<"Device on platform error = "<<err<<std::endl;
-
-	// Print Number of devices on Platform 1 - Intel CPU Runtime
-	std::cout<<"Number of devices on "<<platform.getInfo<CL_PLATFORM_NAME>()
-			 <<" is "<<devices.size()<<"\n"<<std::endl;
-
-	// Get device
-	auto device = devices[0];
-	auto device_name = device.getInfo<CL_DEVICE_NAME>();
-	std::cout<<"Device Name: "<<device_name<<"\n"<<std::endl;
-
-
-	// [D]:Create Context and Queue for Device
-	cl::Context context(device);
-	cl::CommandQueue queue(context,device,0,&err);
-	std::cout<<"Creating queue error = "<<err<<std::endl;
-	err = queue.getInfo<CL_QUEUE_PROPERTIES>();
-	std::cout<<"Queue properties error = "<<err<<std::endl;
-
-
-	// [E]:Create Memory Buffers
-	cl::Buffer A_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double)*nx,A);
-	cl::Buffer b_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double)*ny,b);
-	//cl::Buffer xn_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(int)*ny,xn);
-	//cl::Buffer x_buf(context, CL_MEM_WRITE_ONLY | CL_MEM_COPY_HOST_PTR,sizeof(int)*ny,x);
-
-
- 	// [F]:Program and Kernel
-	// First write the kernel to be executed then build the program before
-	// 	setting the kernel
-	FILE *fp;
-    char *source_str;
-    size_t source_size;
-
-    fp = fopen("cl_jacobi.cl", "r");
-    if (!fp) {
-        fprintf(stderr, "Failed to load kernel.\n");
-        exit(1);
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // printf("OpenCL C++ library found!\n");
+    // std::cout<<"C++ OpenCL ver 2 check" << std::endl;
+
+    cl_int err;
+
+    // [0]:Command Line Options
+    const char* usage =
+        "Usage: %s [--legacy] [--check-every N] [--norm inf|2] [--format dense|csr|ell|stencil] [--n N]\n"
+        "       [--precision double|single|mixed] [--tol T] [--method jacobi|gs|sor] [--omega W] [--2d]\n"
+        "       [--multi-device] [--numa]\n";
+    bool device_resident = true;   // Keep the whole iteration on the device
+    const char* format = "dense";  // Storage of A for the device-resident solver
+    int ny = 3;                    // System size
+    const char* precision = "";    // Device scalar; empty for the default
+    bool grid2d = false;           // 5-point Poisson on an N x N grid
+    bool multi_device = false;     // Row blocks over every device (CSR)
+    bool numa = false;             // ... or over the NUMA nodes of the device
+    clp::JacobiOptions options;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--legacy") == 0)
+        {
+            device_resident = false;
+        }
+        else if (strcmp(argv[arg], "--check-every") == 0 && arg + 1 < argc)
+        {
+            options.check_every = atoi(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--norm") == 0 && arg + 1 < argc)
+        {
+            arg++;
+            if (strcmp(argv[arg], "inf") == 0)
+            {
+                options.norm = clp::Norm::Inf;
+            }
+            else if (strcmp(argv[arg], "2") == 0)
+            {
+                options.norm = clp::Norm::Two;
+            }
+            else
+            {
+                fprintf(stderr, "Unknown norm '%s', expected inf or 2\n", argv[arg]);
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--format") == 0 && arg + 1 < argc)
+        {
+            format = argv[++arg];
+            if (strcmp(format, "dense") != 0 && strcmp(format, "csr") != 0 && strcmp(format, "ell") != 0 &&
+                strcmp(format, "stencil") != 0)
+            {
+                fprintf(stderr, "Unknown format '%s', expected dense, csr, ell or stencil\n", format);
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--precision") == 0 && arg + 1 < argc)
+        {
+            precision = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "--method") == 0 && arg + 1 < argc)
+        {
+            arg++;
+            if (strcmp(argv[arg], "jacobi") == 0)
+            {
+                options.method = clp::StationaryMethod::Jacobi;
+            }
+            else if (strcmp(argv[arg], "gs") == 0)
+            {
+                options.method = clp::StationaryMethod::GaussSeidel;
+            }
+            else if (strcmp(argv[arg], "sor") == 0)
+            {
+                options.method = clp::StationaryMethod::Sor;
+            }
+            else
+            {
+                fprintf(stderr, "Unknown method '%s', expected jacobi, gs or sor\n", argv[arg]);
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--omega") == 0 && arg + 1 < argc)
+        {
+            options.omega = atof(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--2d") == 0)
+        {
+            grid2d = true;
+        }
+        else if (strcmp(argv[arg], "--multi-device") == 0)
+        {
+            multi_device = true;
+        }
+        else if (strcmp(argv[arg], "--numa") == 0)
+        {
+            multi_device = true;
+            numa = true;
+        }
+        else if (strcmp(argv[arg], "--tol") == 0 && arg + 1 < argc)
+        {
+            options.tol = atof(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--n") == 0 && arg + 1 < argc)
+        {
+            ny = atoi(argv[++arg]);
+            if (ny < 2)
+            {
+                fprintf(stderr, "--n must be at least 2\n");
+                return 1;
+            }  // end if
+        }
+        else
+        {
+            fprintf(stderr, usage, argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+
+    // [A]:Problem Setup, for the OpenCL device or, without one, the
+    // 	native host backend (see cl_runtime.h)
+    clp::Backend backend = clp::Backend::OpenCL;
+    try
+    {
+        backend = clp::select_backend();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    const bool native = backend == clp::Backend::Native;
+    int maxiter = options.maxiter;
+    double tol = options.tol;
+    const int points = ny;                                        // Grid points per dimension
+    const bool matrix_free = device_resident && !native && !multi_device && strcmp(format, "stencil") == 0;
+    clp::CsrMatrix A_csr;                                         // Left Hand Side, unless matrix-free
+    if (!matrix_free)
+    {
+        A_csr = grid2d ? clp::poisson2d_csr(points, points) : clp::tridiagonal_csr(points, -1, 2, -1);
+    }
+    ny = grid2d ? points * points : points;                       // Unknowns
+    std::vector<double> b(ny, 0.0);                               // Right Hand Side
+    std::vector<double> x(ny, 1.0);                               // Initial Guess
+    b[0] = 200;
+    b[ny - 1] = 400;
+
+    // The dense copy is only built when something needs it
+    const bool dense = !native && (!device_resident || (!multi_device && strcmp(format, "dense") == 0));
+    std::vector<double> A(dense ? static_cast<size_t>(ny) * ny : 0, 0.0);
+    if (dense)
+    {
+        for (int row = 0; row < ny; row++)
+        {
+            for (int k = A_csr.row_ptr[row]; k < A_csr.row_ptr[row + 1]; k++)
+            {
+                A[A_csr.col_idx[k] + static_cast<size_t>(ny) * row] = A_csr.values[k];
+            }  // end k
+        }  // end row
     }
-    source_str = (char*)malloc(MAX_SOURCE_SIZE);
-    source_size = fread( source_str, 1, MAX_SOURCE_SIZE, fp);
-    fclose(fp);
-
-
-	cl::Program program(context,source_str);
-
-	//program.build("-cl-std=CL2.0");
-
-	try {
-		program.build("-cl-std=CL2.0");
-	} catch (...) {
-		// Print build info for all devices
-		cl_int buildErr = CL_SUCCESS;
-		auto buildInfo = program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(&buildErr);
-		for (auto &pair : buildInfo) {
-			std::cerr << pair.second << std::endl << std::endl;
-		}
-
-		return 1;
-	}
-
-	cl::Kernel kernel(program,"cl_jacobi");
-
-	// [G]:Iterate
-	int iter = 1;
-	int i;
-	for (i = 0; i < ny; i++){
-		matmult(A,x,tmp,ny,ny,1);
-		RES[i] = fabs(b[i] - tmp[i]);
-	}//end i
-
-	printf("iter = %d | Max Residual = %f\n",iter,max(RES,ny));
-
-	while (max(RES,ny) > tol){
-		memcpy(xn,x,sizeof(xn));
-
-		// [H]:Advance Iteration Counter
-		iter += 1;
-
-		cl::Buffer xn_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double)*ny,xn);
-		cl::Buffer x_buf(context, CL_MEM_WRITE_ONLY | CL_MEM_COPY_HOST_PTR,sizeof(double)*ny,x);
-
-		// [I]:Set Kernel Arguments
-		kernel.setArg(0,ny);
-		kernel.setArg(1,A_buf);
-		kernel.setArg(2,b_buf);
-		kernel.setArg(3,xn_buf);
-		kernel.setArg(4,x_buf);
-
-		// [J]:Enqueue Kernel
-		cl::NDRange global(ny);
-		cl::NDRange local(1);
-		err = queue.enqueueNDRangeKernel(kernel,cl::NullRange, global, local);
-		if (iter == 2){
-			std::cout<<"Execute kernel error number = "<<err<<std::endl;
-		}//end if
-
-		err = queue.enqueueReadBuffer(x_buf,CL_TRUE,0,sizeof(double)*ny,x);
-		if (iter == 2){
-			std::cout<<"Reading result buffer error = "<<err<<std::endl;
-		}//end if
-
-		for (i = 0; i < ny; i++){
-			matmult(A,x,tmp,ny,ny,1);
-			RES[i] = fabs(b[i] - tmp[i]);
-		}//end i
-
-
-		printf("iter = %d | Max Residual = %f\n",iter,max(RES,ny));
-
-		if (iter == maxiter){
-			break;
-		}
-
-	}//end while
-
-
-	std::cout<<"Code executed successfully!"<<std::endl;
-
-
-
-	// Display Result
-	for (i = 0; i < ny; i++){
-		std::cout<<x[i]<<std::endl;
-	}//end i
-
-
-}//END program
-
-
-
 
+    // Native backend: threaded host Jacobi on A_csr (see host_kernels.h),
+    // 	reported like the device paths below
+    if (native)
+    {
+        clp::SolveResult result;
+        try
+        {
+            printf("Backend: native, %d host threads\n", clp::host::ThreadPool::instance().size());
+            result = clp::host::jacobi_solve(A_csr, b, x, options);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        std::cout << "Code executed successfully!" << std::endl;
+        printf("Iterations: %d\n", result.iterations);
+        for (int row = 0; row < std::min(ny, 16); row++)
+        {
+            std::cout << x[row] << std::endl;
+        }  // end row
+        return 0;
+    }
 
+    // [B]:Platform, Device, Context and Queue
+    // Discovery and selection live in the shared runtime (see cl_runtime.h).
+    // NOTE: During debugging, platform[0] is the "Intel CPU Compute Runtime",
+    // 	while platform[1] is named "Portable Computing Language"; use
+    // 	CLP_PLATFORM to choose between them
+    clp::Runtime& runtime = clp::Runtime::instance();
+    runtime.print_selection();
+
+    const cl::Context& context = runtime.context();
+    cl::CommandQueue& queue = runtime.queue();
+
+    // [C]:Create Memory Buffers
+    // Zero-copy on CPU devices (see cl_buffer.h)
+    clp::HostBuffer<double> b_buf(b.data(), ny, CL_MEM_READ_ONLY);
+
+    // [D]..[I]:Iterate
+    int iter = 1;
+    int i;
+
+    if (multi_device)
+    {
+        // [D]:Row blocks of A_csr, balanced by measured throughput (see
+        // 	cl_multidevice.h)
+        try
+        {
+            clp::DeviceGroup group =
+                numa ? clp::DeviceGroup::numa_domains(runtime.device()) : clp::DeviceGroup::platform_devices();
+            group.print();
+            clp::DistributedCsr A_dist(group, A_csr);
+            A_dist.print_partition();
+
+            // [E]:Jacobi with a halo exchange after every sweep
+            iter = clp::multi_device_jacobi(A_dist, b, x, options).iterations;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+    else if (device_resident)
+    {
+        // [D]:Operator in the requested storage format and precision; each
+        // 	one builds its own program (cl_jacobi.cl or cl_sparse.cl). Mixed
+        // 	precision needs the matrix in both
+        clp::Precision mode = clp::Precision::Double;
+        std::unique_ptr<clp::DeviceOperator> op;
+        std::unique_ptr<clp::DeviceOperator> op_single;
+        try
+        {
+            mode = *precision ? clp::parse_precision(precision) : clp::default_precision();
+            if (mode == clp::Precision::Single)
+            {
+                op = make_operator<float>(format, points, grid2d ? points : 0, A_csr, A);
+            }
+            else
+            {
+                op = make_operator<double>(format, points, grid2d ? points : 0, A_csr, A);
+            }  // end if
+            if (mode == clp::Precision::Mixed)
+            {
+                op_single = make_operator<float>(format, points, grid2d ? points : 0, A_csr, A);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        printf("Matrix format: %s (n = %d, nnz = %d), %s precision, %s\n",
+               format,
+               ny,
+               A_csr.nnz(),
+               clp::precision_name(mode),
+               clp::stationary_method_name(options.method));
+
+        // [E]:Device-resident Jacobi (see cl_jacobi_solver.h), or fp32
+        // 	Jacobi under fp64 refinement (see cl_precision.h)
+        if (mode == clp::Precision::Mixed)
+        {
+            clp::RefinementOptions refine;
+            refine.tol = options.tol;
+            refine.norm = options.norm;
+            refine.inner = options;
+            refine.inner.verbose = false;
+            clp::HostBuffer<double> x_buf(x.data(), ny, CL_MEM_READ_WRITE);
+            try
+            {
+                clp::RefinementSolver solver(refine);
+                clp::RefinementResult result = solver.solve(queue, *op, *op_single, b_buf.buffer(), x_buf.buffer());
+                iter = result.iterations;
+                printf("Refinements: %d\n", result.refinements);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << e.what() << std::endl;
+                return 1;
+            }
+
+            // [F]:Map the converged solution once
+            const double* x_dev = x_buf.map(queue, CL_MAP_READ);
+            std::copy(x_dev, x_dev + ny, x.begin());
+            x_buf.unmap(queue);
+        }
+        else if (mode == clp::Precision::Single)
+        {
+            iter = solve_in<float>(queue, *op, b, x, options).iterations;
+        }
+        else
+        {
+            iter = solve_in<double>(queue, *op, b, x, options).iterations;
+        }  // end if
+    }
+    else
+    {
+        // [D]:Program and Kernel
+        // First load the kernel source to be executed then build the program
+        // 	before setting the kernel
+        cl::Program program;
+        try
+        {
+            program = clp::build_program(clp::load_kernel_source("cl_jacobi.cl"));
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        cl::Kernel kernel(program, "cl_jacobi");
+        cl::Buffer A_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double) * A.size(), A.data());
+        std::vector<double> xn(ny), RES(ny), tmp(ny);
+
+        for (i = 0; i < ny; i++)
+        {
+            matmult(A.data(), x.data(), tmp.data(), ny, ny, 1);
+            RES[i] = fabs(b[i] - tmp[i]);
+        }  // end i
+
+        printf("iter = %d | Max Residual = %f\n", iter, max(RES.data(), ny));
+
+        while (max(RES.data(), ny) > tol)
+        {
+            xn = x;
+
+            // [E]:Advance Iteration Counter
+            iter += 1;
+
+            // Leased per iteration as before, but from the pool: only the
+            // 	first iteration creates buffers
+            clp::BufferLease xn_buf = clp::BufferPool::instance().acquire(sizeof(double) * ny, CL_MEM_READ_ONLY);
+            clp::BufferLease x_buf = clp::BufferPool::instance().acquire(sizeof(double) * ny, CL_MEM_WRITE_ONLY);
+            queue.enqueueWriteBuffer(xn_buf.buffer(), CL_FALSE, 0, sizeof(double) * ny, xn.data());
+
+            // [F]:Set Kernel Arguments
+            kernel.setArg(0, ny);
+            kernel.setArg(1, A_buf);
+            kernel.setArg(2, b_buf.buffer());
+            kernel.setArg(3, xn_buf.buffer());
+            kernel.setArg(4, x_buf.buffer());
+
+            // [G]:Enqueue Kernel
+            cl::NDRange global(ny);
+            cl::NDRange local(1);
+            err = queue.enqueueNDRangeKernel(kernel, cl::NullRange, global, local);
+            if (iter == 2)
+            {
+                std::cout << "Execute kernel error number = " << err << std::endl;
+            }  // end if
+
+            err = queue.enqueueReadBuffer(x_buf.buffer(), CL_TRUE, 0, sizeof(double) * ny, x.data());
+            if (iter == 2)
+            {
+                std::cout << "Reading result buffer error = " << err << std::endl;
+            }  // end if
+
+            for (i = 0; i < ny; i++)
+            {
+                matmult(A.data(), x.data(), tmp.data(), ny, ny, 1);
+                RES[i] = fabs(b[i] - tmp[i]);
+            }  // end i
+
+            printf("iter = %d | Max Residual = %f\n", iter, max(RES.data(), ny));
+
+            if (iter == maxiter)
+            {
+                break;
+            }
+
+        }  // end while
+
+    }  // end if
+
+    std::cout << "Code executed successfully!" << std::endl;
+    printf("Iterations: %d\n", iter);
+    clp::BufferPool::instance().print_stats();
+
+    // Display Result
+    for (i = 0; i < std::min(ny, 16); i++)
+    {
+        std::cout << x[i] << std::endl;
+    }  // end i
+
+    return 0;
+
+}  // END program
 
 /************************************************************************
-* Print All Platforms Functions 										*
-************************************************************************/
-
-int print_platforms(int num_platforms, std::vector<cl::Platform> platforms){
-
-	int i;
-	for (i = 0; i < num_platforms; i++){
-
-		auto platform_profile 	 = platforms[i].getInfo<CL_PLATFORM_PROFILE>();
-		auto platform_name    	 = platforms[i].getInfo<CL_PLATFORM_NAME>();
-		auto platform_vendor  	 = platforms[i].getInfo<CL_PLATFORM_VENDOR>();
-		auto platform_version 	 = platforms[i].getInfo<CL_PLATFORM_VERSION>();
-		auto platform_extensions = platforms[i].getInfo<CL_PLATFORM_EXTENSIONS>();
-
-		std::cout<<"\nPlatform Profile	: "<<platform_profile<<std::endl;
-		std::cout<<"Platform Name		: "<<platform_name<<std::endl;
-		std::cout<<"Platform Vendor		: "<<platform_vendor<<std::endl;
-		std::cout<<"Platform Version	: "<<platform_version<<std::endl;
-		std::cout<<"Platform Extensions	: "<<platform_extensions<<"\n"<<std::endl;
-
-	}//end i
-
-	return 0;
-
-}//end FUNCTION print_platforms
-
-
-//"__kernel void cl_jacobi("
-//				"int ny, const __global double *A, const __global double *b, const __global double *xn, __global double *x"
-//				")"
-//				"{"
-//					"/*[A]:Get Global ID*/"
-//					"int gid  = get_global_id(0);"
-
-//					"/*[B]:Calculate sum*/"
-//					"int k,sum;"
-//					"int j = gid;"
-
-//					"for (k = 0; k < ny; k++){"
-//						"if (k != gid){"
-//							"sum += A[k+ny*gid]*xn[k];"
-//						"}/*end if*/"
-//					"}/*end k*/"
-
-//					"/*[C]:Calculate next iteration*/"
-//					"x[gid] = (b[gid] - sum)/A[gid+ny*gid];"
-//				"}"
-//*/
+ * Device-Resident Solve												*
+ ************************************************************************/
+
+template <typename Real>
+std::unique_ptr<clp::DeviceOperator> make_operator(const char* format,
+                                                   int nx,
+                                                   int ny,
+                                                   const clp::CsrMatrix& A_csr,
+                                                   const std::vector<double>& A)
+{
+    if (strcmp(format, "stencil") == 0)
+    {
+        return std::unique_ptr<clp::DeviceOperator>(new clp::StencilOperator<Real>(nx, ny));
+    }
+    if (strcmp(format, "csr") == 0)
+    {
+        return std::unique_ptr<clp::DeviceOperator>(new clp::CsrOperator<Real>(A_csr));
+    }
+    if (strcmp(format, "ell") == 0)
+    {
+        return std::unique_ptr<clp::DeviceOperator>(new clp::EllOperator<Real>(clp::ell_from_csr(A_csr)));
+    }
+    return std::unique_ptr<clp::DeviceOperator>(new clp::DenseOperator<Real>(A.data(), A_csr.rows));
+
+}  // end FUNCTION make_operator
+
+template <typename Real>
+clp::SolveResult solve_in(cl::CommandQueue& queue,
+                          clp::DeviceOperator& op,
+                          const std::vector<double>& b,
+                          std::vector<double>& x,
+                          const clp::JacobiOptions& options)
+{
+    const int ny = op.rows();
+    const std::vector<Real> b_real(b.begin(), b.end());
+    const std::vector<Real> x_real(x.begin(), x.end());
+    clp::HostBuffer<Real> b_buf(b_real.data(), ny, CL_MEM_READ_ONLY);
+    clp::HostBuffer<Real> x_buf(x_real.data(), ny, CL_MEM_READ_WRITE);
+    clp::JacobiSolver solver(options);
+    clp::SolveResult result = solver.solve(queue, op, b_buf.buffer(), x_buf.buffer());
+
+    // [F]:Map the converged solution once
+    const Real* x_dev = x_buf.map(queue, CL_MAP_READ);
+    std::copy(x_dev, x_dev + ny, x.begin());
+    x_buf.unmap(queue);
+    std::cout << "Buffers: " << clp::buffer_mode_name(x_buf.mode()) << std::endl;
+    return result;
+
+}  // end FUNCTION solve_in
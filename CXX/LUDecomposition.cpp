@@ -0,0 +1,131 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: LU Decomposition
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * This code solves a dense system Ax = b with the blocked, pivoted LU	*
+ * 	factorization (see cl_lu.h): host panels on the host thread pool,	*
+ * 	trailing updates on the OpenCL device.								*
+ *																		*
+ * Usage: LUDecomposition [N] [--block NB] [--host] [--threads T]		*
+ * 	A is random in [-1, 1] (not diagonally dominant, so pivoting is		*
+ * 	required) and b = A (1, ..., 1), so the exact solution is all ones.	*
+ * 	--host keeps every step on the host; --threads sizes its pool.		*
+ ************************************************************************/
+
+#include "cl_lu.h"
+#include "cl_runtime.h"
+#include "host_blas.h"
+#include "host_thread_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [0]:Command Line Options
+    int n = 2048;
+    int threads = 0;  // 0: ThreadPool::instance() (CLP_HOST_THREADS)
+    clp::LuOptions options;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--block") == 0 && arg + 1 < argc)
+        {
+            options.block = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--threads") == 0 && arg + 1 < argc)
+        {
+            threads = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--host") == 0)
+        {
+            options.device_update = false;
+        }
+        else if (atoi(argv[arg]) > 0)
+        {
+            n = atoi(argv[arg]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [N] [--block NB] [--host] [--threads T]\n", argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+
+    // [A]:Problem Setup
+    std::vector<double> A(static_cast<size_t>(n) * n);
+    std::mt19937 generator(2026);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    for (double& a : A)
+    {
+        a = uniform(generator);
+    }
+    const std::vector<double> ones(n, 1.0);
+    std::vector<double> b(n, 0.0);
+    clp::host::gemv(n, n, 1.0, A.data(), n, ones.data(), 0.0, b.data());
+    const std::vector<double> A0 = A;
+    const std::vector<double> b0 = b;
+
+    // [B]:Platform and Device (see cl_runtime.h)
+    if (options.device_update)
+    {
+        clp::Runtime::instance().print_selection();
+    }
+    std::unique_ptr<clp::host::ThreadPool> own_pool;
+    if (threads > 0)
+    {
+        own_pool.reset(new clp::host::ThreadPool(threads));
+    }
+    clp::host::ThreadPool& pool = own_pool ? *own_pool : clp::host::ThreadPool::instance();
+    printf("n = %d, block = %d, updates on the %s, %d host thread(s)\n",
+           n,
+           options.block,
+           options.device_update ? "device" : "host",
+           pool.size());
+
+    // [C]:Factor and Solve
+    clp::DenseLu lu(options, pool);
+    std::vector<int> ipiv;
+    const auto start = std::chrono::steady_clock::now();
+    try
+    {
+        lu.factor(n, A.data(), n, ipiv);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    clp::lu_solve(n, A.data(), n, ipiv, b.data());
+
+    // [D]:Check: error against the exact solution and relative residual
+    double max_error = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        max_error = std::max(max_error, fabs(b[i] - 1.0));
+    }  // end i
+    std::vector<double> r = b0;
+    clp::host::gemv(n, n, -1.0, A0.data(), n, b.data(), 1.0, r.data());
+    const double residual = clp::host::amax(n, r.data()) / clp::host::amax(n, b0.data());
+
+    std::cout << "Code executed successfully!" << std::endl;
+    const double flops = 2.0 / 3.0 * n * n * static_cast<double>(n);
+    printf("Factor: %.3f ms, %.2f GFLOP/s\n", 1e3 * seconds, flops / seconds * 1e-9);
+    printf("max |x - 1| = %e, |b - Ax| / |b| = %e\n", max_error, residual);
+
+    return max_error < 1e-6 ? 0 : 1;
+
+}  // END program
@@ -1,174 +1,326 @@
 // Alejandro Valencia
 // OpenCL C++ Projects: Matrix Multiplication
 // Start: 22 June, 2019
-// Update: 22 June, 2019
+// Update: 18 October, 2026
 
 /************************************************************************
-* This code serves as a test bench for OpenCL Projects in C++ 			*
-************************************************************************/
-
-#define CL_HPP_ENABLE_EXCEPTIONS
-#define CL_HPP_TARGET_OPENCL_VERSION 200
-
+ * Tiled SGEMM/DGEMM (cl_gemm.cl) benchmarked against the naive host	*
+ * 	matmult from mylib.h, the vectorized host gemm (host_blas.h) and	*
+ * 	the same gemm threaded over row blocks (host_kernels.h).			*
+ *																		*
+ * Usage: MatrixMultiply [M N K] [--tile TS] [--wpt W] [--single]		*
+ * 						 [--repeat R] [--chunks C]						*
+ * 	Without --tile/--wpt the auto-tuned configuration is used. --chunks	*
+ * 	also streams A and C in C row chunks (B resident), once step by		*
+ * 	blocking step and once through the async pipeline (cl_pipeline.h);	*
+ * 	0 skips it. Without a usable OpenCL device (or with					*
+ * 	CLP_BACKEND=native) only the host versions run.						*
+ ************************************************************************/
+
+#include "cl_buffer.h"
+#include "cl_buffer_pool.h"
+#include "cl_gemm.h"
+#include "cl_pipeline.h"
+#include "cl_runtime.h"
+#include "host_blas.h"
+#include "host_kernels.h"
+#include "mylib.h"
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <vector>
 #include <stdio.h>
 #include <stdlib.h>
-#include <CL/cl2.hpp>
-#include <iostream>
+#include <string.h>
 
 /************************************************************************
-* Function Declarations 												*
-************************************************************************/
-
-	int print_platforms(int,std::vector<cl::Platform>);
+ * Function Declarations 												*
+ ************************************************************************/
 
-//end Function Declarations
+// Host baselines, then the device runs unless "native"
+template <typename Real>
+int run_gemm(int M, int N, int K, clp::GemmConfig config, bool autotune, int repeat, int chunks, bool native);
 
+// end Function Declarations
 
 /************************************************************************
-* Main Program 															*
-************************************************************************/
-
-int main(){
-	//printf("OpenCL C++ library found!\n");
-	//std::cout<<"C++ OpenCL ver 2 check" << std::endl;
-
-	cl_int err;
-
-	// [A]:Problem Setup
-	int nx = 4;
-	int ny = 2;
-	int a[nx] = {1,0,0,2};
-	int b[nx] = {0,2,0,2};
-	int c[nx];
-	int result[ny];
-
-
-	// [B]:Create Platform Object
-	// Filter for a 2.0 platform and set it as the default
-    std::vector<cl::Platform> platforms; 		// Declare "platforms" as std type vector cl type Platform
-	cl::Platform::get(&platforms); 				// Using scope cd::Platform get all platforms and place in variable platforms
-
-	int  num_platforms = platforms.size(); 		// Use platform.size() to get number of platforms
-	std::cout<<"Number of Platforms: "
-			 <<num_platforms<<std::endl;   		// Print number of platforms
-
-
-	// [B.1]:Print Platform Atributions
-	//print_platforms(num_platforms,platforms);
-
-
-	// [C]:Get Devices for Said Platforms
-	// NOTE: During debugging, platform[0] is the "Intel CPU Compute Runtime",
-	// 	while platform[1] is named "Portable Computing Language"
-
-	auto platform = platforms[0];
-
-	std::vector<cl::Device> devices; 					// Declare "devices" as a std type vector cl type Device
-	err = platform.getDevices(CL_DEVICE_TYPE_ALL, &devices);	// Get ALL devices associated with Intel CPU Runtime
-	std::cout<<"Device on platform error = "<<err<<std::endl;
-
-	// Print Number of devices on Platform 1 - Intel CPU Runtime
-	std::cout<<"Number of devices on "<<platform.getInfo<CL_PLATFORM_NAME>()
-			 <<" is "<<devices.size()<<"\n"<<std::endl;
-
-	// Get device
-	auto device = devices[0];
-	auto device_name = device.getInfo<CL_DEVICE_NAME>();
-	std::cout<<"Device Name: "<<device_name<<"\n"<<std::endl;
-
-
-	// [D]:Create Context and Queue for Device
-	cl::Context context(device);
-	cl::CommandQueue queue(context,device,0,&err);
-	std::cout<<"Creating queue error = "<<err<<std::endl;
-	err = queue.getInfo<CL_QUEUE_PROPERTIES>();
-	std::cout<<"Queue properties error = "<<err<<std::endl;
-
-
-	// [E]:Create Memory Buffers
-	cl::Buffer a_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(int)*nx,a);
-	cl::Buffer b_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(int)*nx,b);
-	cl::Buffer c_buf(context, CL_MEM_WRITE_ONLY | CL_MEM_COPY_HOST_PTR,sizeof(int)*nx,c);
-
-
- 	// [F]:Program and Kernel
-	// First write the kernel to be executed then build the program before
-	// 	setting the kernel
-	cl::Program program(context,"__kernel void cl_mat_mult("
-					"const __global int *a, const __global int *b, __global int *c)"
-					"{"
-						"int gid  = get_global_id(0);"
-						"c[gid] = a[gid] * b[gid];"
-					"}");
-	program.build("-cl-std=CL2.0");
-//	program.build(device);
-
-	cl::Kernel kernel(program,"cl_mat_mult");
-
-	// [G]:Set Kernel Arguments
-	kernel.setArg(0,a_buf);
-	kernel.setArg(1,b_buf);
-	kernel.setArg(2,c_buf);
-
-	// [H]:Enqueue Kernel
-	cl::NDRange global(4);
-	cl::NDRange local(1);
-	err = queue.enqueueNDRangeKernel(kernel,cl::NullRange, global, local);
-	std::cout<<"Execute kernel error number = "<<err<<std::endl;
-
-	err = queue.enqueueReadBuffer(c_buf,CL_TRUE,0,sizeof(int)*4,c);
-	std::cout<<"Reading result buffer error = "<<err<<std::endl;
-
-	//cl::finish();
-
-	std::cout<<"Code executed successfully!"<<std::endl;
-
-	int i,k;
-	for (i = 0; i < ny; i++){
-		int sum;
-		for (k = 0; k < ny; k++){
-			sum += c[k+ny*i];
-		}//end k
-
-		result[i] = sum;
-	}//end i
-
-	// Display Result
-	for (i = 0; i < ny; i++){
-		std::cout<<result[i]<<std::endl;
-	}//end i
-
-
-}//END program
-
-
-
-
-
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [A]:Problem Setup
+    int M = 512;
+    int N = 512;
+    int K = 512;
+    int repeat = 5;
+    int chunks = 4;
+    bool single = false;
+    bool autotune = true;
+    clp::GemmConfig config;
+
+    int positional = 0;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--tile") == 0 && arg + 1 < argc)
+        {
+            config.tile = atoi(argv[++arg]);
+            autotune = false;
+        }
+        else if (strcmp(argv[arg], "--wpt") == 0 && arg + 1 < argc)
+        {
+            config.wpt = atoi(argv[++arg]);
+            autotune = false;
+        }
+        else if (strcmp(argv[arg], "--repeat") == 0 && arg + 1 < argc)
+        {
+            repeat = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--chunks") == 0 && arg + 1 < argc)
+        {
+            chunks = std::max(0, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--single") == 0)
+        {
+            single = true;
+        }
+        else if (positional < 3 && atoi(argv[arg]) > 0)
+        {
+            int* dims[3] = {&M, &N, &K};
+            *dims[positional++] = atoi(argv[arg]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [M N K] [--tile TS] [--wpt W] [--single] [--repeat R] [--chunks C]\n",
+                    argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+
+    // [B]:Platform, Device, Context and Queue
+    // Discovery and selection live in the shared runtime (see cl_runtime.h);
+    // 	without a device only the host versions run
+    bool native = false;
+    try
+    {
+        native = clp::select_backend() == clp::Backend::Native;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (!native)
+    {
+        clp::Runtime::instance().print_selection();
+    }
+
+    return single ? run_gemm<float>(M, N, K, config, autotune, repeat, chunks, native)
+                  : run_gemm<double>(M, N, K, config, autotune, repeat, chunks, native);
+
+}  // END program
 
 /************************************************************************
-* Print All Platforms Functions 										*
-************************************************************************/
-
-int print_platforms(int num_platforms, std::vector<cl::Platform> platforms){
-
-	int i;
-	for (i = 0; i < num_platforms; i++){
-
-		auto platform_profile 	 = platforms[i].getInfo<CL_PLATFORM_PROFILE>();
-		auto platform_name    	 = platforms[i].getInfo<CL_PLATFORM_NAME>();
-		auto platform_vendor  	 = platforms[i].getInfo<CL_PLATFORM_VENDOR>();
-		auto platform_version 	 = platforms[i].getInfo<CL_PLATFORM_VERSION>();
-		auto platform_extensions = platforms[i].getInfo<CL_PLATFORM_EXTENSIONS>();
-
-		std::cout<<"\nPlatform Profile	: "<<platform_profile<<std::endl;
-		std::cout<<"Platform Name		: "<<platform_name<<std::endl;
-		std::cout<<"Platform Vendor		: "<<platform_vendor<<std::endl;
-		std::cout<<"Platform Version	: "<<platform_version<<std::endl;
-		std::cout<<"Platform Extensions	: "<<platform_extensions<<"\n"<<std::endl;
-
-	}//end i
-
-	return 0;
-
-}//end FUNCTION print_platforms
+ * GEMM Benchmark														*
+ ************************************************************************/
+
+template <typename Real>
+int run_gemm(int M, int N, int K, clp::GemmConfig config, bool autotune, int repeat, int chunks, bool native)
+{
+    using clock = std::chrono::steady_clock;
+    const double flops = 2.0 * M * N * K;
+
+    // [C]:Random operands; the host baseline runs in double
+    std::vector<double> A(static_cast<size_t>(M) * K), B(static_cast<size_t>(K) * N), C(static_cast<size_t>(M) * N);
+    srand(42);
+    for (double& a : A)
+    {
+        a = rand() / (double)RAND_MAX - 0.5;
+    }
+    for (double& b : B)
+    {
+        b = rand() / (double)RAND_MAX - 0.5;
+    }
+
+    // [D]:Host Baselines (mylib.h matmult, the blocked SIMD gemm and the
+    // 	threaded gemm), the serial gemm doubling as the reference
+    auto start = clock::now();
+    matmult(A.data(), B.data(), C.data(), M, K, N);
+    double host_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::vector<double> reference(C.size());
+    start = clock::now();
+    clp::host::gemm(M, N, K, 1.0, A.data(), K, B.data(), N, 0.0, reference.data(), N);
+    double blas_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    std::vector<double> threaded(C.size());
+    start = clock::now();
+    clp::host::parallel_gemm(M, N, K, 1.0, A.data(), K, B.data(), N, 0.0, threaded.data(), N);
+    double threaded_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    double host_error = 0.0;
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        host_error = std::max({host_error, fabs(reference[i] - C[i]), fabs(reference[i] - threaded[i])});
+    }  // end i
+
+    auto print_host = [&]() {
+        printf("Host matmult : %10.4f s | %8.3f GFLOP/s\n", host_seconds, flops / host_seconds * 1e-9);
+        printf("Host gemm    : %10.4f s | %8.3f GFLOP/s (%s)\n",
+               blas_seconds,
+               flops / blas_seconds * 1e-9,
+               clp::host::isa_name(clp::host::active_isa()));
+        printf("Threaded gemm: %10.4f s | %8.3f GFLOP/s (%d threads)\n",
+               threaded_seconds,
+               flops / threaded_seconds * 1e-9,
+               clp::host::ThreadPool::instance().size());
+    };
+    if (native)
+    {
+        printf("DGEMM %d x %d x %d | backend: native\n", M, N, K);
+        print_host();
+        printf("Max |error|  : %e (host matmult and threaded gemm vs gemm)\n", host_error);
+        return host_error <= 1e-10 * K ? 0 : 1;
+    }
+
+    // [E]:Device Buffers and Kernel
+    clp::Runtime& runtime = clp::Runtime::instance();
+    cl::CommandQueue& queue = runtime.queue();
+
+    // The operands are converted straight into the (on CPU devices shared)
+    // 	buffer storage, see cl_buffer.h
+    clp::HostBuffer<Real> A_buf(A.size(), CL_MEM_READ_ONLY);
+    clp::HostBuffer<Real> B_buf(B.size(), CL_MEM_READ_ONLY);
+    clp::HostBuffer<Real> C_buf(C.size(), CL_MEM_READ_WRITE);
+    std::copy(A.begin(), A.end(), A_buf.map(queue, CL_MAP_WRITE_INVALIDATE_REGION));
+    std::copy(B.begin(), B.end(), B_buf.map(queue, CL_MAP_WRITE_INVALIDATE_REGION));
+    A_buf.unmap(queue);
+    B_buf.unmap(queue);
+
+    if (autotune)
+    {
+        config = clp::tuned_gemm_config<Real>(M, N, K);
+    }
+    clp::Gemm<Real> gemm(config);
+
+    // [F]:Warm up once, then time "repeat" launches
+    gemm(queue, M, N, K, Real(1), A_buf.buffer(), B_buf.buffer(), Real(0), C_buf.buffer());
+    queue.finish();
+
+    start = clock::now();
+    for (int r = 0; r < repeat; r++)
+    {
+        gemm(queue, M, N, K, Real(1), A_buf.buffer(), B_buf.buffer(), Real(0), C_buf.buffer());
+    }  // end r
+    queue.finish();
+    double device_seconds = std::chrono::duration<double>(clock::now() - start).count() / repeat;
+
+    // [G]:Verify and Report
+    const Real* c_dev = C_buf.map(queue, CL_MAP_READ);
+    double max_error = 0.0;
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        max_error = std::max(max_error, fabs(reference[i] - (double)c_dev[i]));
+    }  // end i
+    C_buf.unmap(queue);
+
+    // [H]:Streamed: A and C move in row chunks while B stays resident,
+    // 	first one blocking step at a time, then through the async pipeline
+    double blocking_seconds = 0.0;
+    double pipeline_seconds = 0.0;
+    double stream_error = 0.0;
+    bool out_of_order = false;
+    int count = 0;
+    if (chunks > 0)
+    {
+        const int rows = (M + chunks - 1) / chunks;
+        count = (M + rows - 1) / rows;
+        auto chunk_rows = [&](std::size_t chunk) { return std::min(rows, M - static_cast<int>(chunk) * rows); };
+        const std::vector<Real> a_host(A.begin(), A.end());
+        std::vector<Real> c_host(C.size());
+
+        clp::BufferLease a_chunk = clp::BufferPool::instance().acquire(sizeof(Real) * rows * K, CL_MEM_READ_ONLY);
+        clp::BufferLease c_chunk = clp::BufferPool::instance().acquire(sizeof(Real) * rows * N);
+        start = clock::now();
+        for (int c = 0; c < count; c++)
+        {
+            const int m = chunk_rows(c);
+            queue.enqueueWriteBuffer(
+                a_chunk.buffer(), CL_TRUE, 0, sizeof(Real) * m * K, a_host.data() + static_cast<size_t>(c) * rows * K);
+            gemm(queue, m, N, K, Real(1), a_chunk.buffer(), B_buf.buffer(), Real(0), c_chunk.buffer());
+            queue.enqueueReadBuffer(
+                c_chunk.buffer(), CL_TRUE, 0, sizeof(Real) * m * N, c_host.data() + static_cast<size_t>(c) * rows * N);
+        }  // end c
+        blocking_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+        clp::Pipeline pipeline(sizeof(Real) * rows * K,
+                               sizeof(Real) * rows * N,
+                               [&](cl::CommandQueue& stage_queue,
+                                   std::size_t chunk,
+                                   const cl::Buffer& in,
+                                   cl::Buffer& out,
+                                   const std::vector<cl::Event>& wait,
+                                   cl::Event& done) {
+                                   gemm(stage_queue,
+                                        chunk_rows(chunk),
+                                        N,
+                                        K,
+                                        Real(1),
+                                        in,
+                                        B_buf.buffer(),
+                                        Real(0),
+                                        out,
+                                        &wait,
+                                        &done);
+                               });
+        out_of_order = pipeline.out_of_order();
+        std::fill(c_host.begin(), c_host.end(), Real(0));
+        std::vector<std::future<void>> landed;
+        start = clock::now();
+        for (int c = 0; c < count; c++)
+        {
+            const int m = chunk_rows(c);
+            landed.push_back(pipeline.submit(a_host.data() + static_cast<size_t>(c) * rows * K,
+                                             sizeof(Real) * m * K,
+                                             c_host.data() + static_cast<size_t>(c) * rows * N,
+                                             sizeof(Real) * m * N));
+        }  // end c
+        for (std::future<void>& chunk : landed)
+        {
+            chunk.get();
+        }  // end chunk
+        pipeline_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+        for (size_t i = 0; i < reference.size(); i++)
+        {
+            stream_error = std::max(stream_error, fabs(reference[i] - (double)c_host[i]));
+        }  // end i
+    }
+
+    printf("%s %d x %d x %d | tile = %d, wpt = %d | buffers: %s\n",
+           sizeof(Real) == sizeof(float) ? "SGEMM" : "DGEMM",
+           M,
+           N,
+           K,
+           config.tile,
+           config.wpt,
+           clp::buffer_mode_name(C_buf.mode()));
+    print_host();
+    printf("OpenCL GEMM  : %10.4f s | %8.3f GFLOP/s\n", device_seconds, flops / device_seconds * 1e-9);
+    printf("Speedup      : %10.2fx\n", host_seconds / device_seconds);
+    if (chunks > 0)
+    {
+        printf("Streamed     : %10.4f s blocking | %10.4f s pipelined (%d chunks, %s queue) | max |error| = %e\n",
+               blocking_seconds,
+               pipeline_seconds,
+               count,
+               out_of_order ? "out-of-order" : "in-order per stage",
+               stream_error);
+    }
+    printf("Max |error|  : %e (host matmult and threaded gemm vs gemm: %e)\n", max_error, host_error);
+
+    const double tolerance = (sizeof(Real) == sizeof(float) ? 1e-4 : 1e-10) * K;
+    return max_error <= tolerance && stream_error <= tolerance && host_error <= 1e-10 * K ? 0 : 1;
+
+}  // end FUNCTION run_gemm
@@ -0,0 +1,122 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Geometric Multigrid
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * This code solves the Poisson problem A x = b on a structured grid	*
+ * 	with geometric multigrid V-cycles (see cl_multigrid.h); A is the	*
+ * 	matrix-free stencil of cl_stencil.h, so nothing of size n^2 is		*
+ * 	ever stored.														*
+ *																		*
+ * Usage: Multigrid [--n N] [--dims 1|2|3] [--tol T] [--cycles C]		*
+ * 				    [--smooth S]										*
+ * 	Solves on an N (x N (x N)) grid with b = 1 from x = 0. The cycle	*
+ * 	count should stay flat as N grows (try N = 255, 1023, 4095 in 2-D),	*
+ * 	so the time per unknown stays constant.								*
+ ************************************************************************/
+
+#include "cl_buffer_pool.h"
+#include "cl_multigrid.h"
+#include "cl_runtime.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [0]:Command Line Options
+    const char* usage = "Usage: %s [--n N] [--dims 1|2|3] [--tol T] [--cycles C] [--smooth S]\n";
+    int n = 1023;  // Grid points per dimension
+    int dims = 2;
+    clp::MultigridOptions options;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--n") == 0 && arg + 1 < argc)
+        {
+            n = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--dims") == 0 && arg + 1 < argc)
+        {
+            dims = atoi(argv[++arg]);
+            if (dims < 1 || dims > 3)
+            {
+                fprintf(stderr, "--dims must be 1, 2 or 3\n");
+                return 1;
+            }  // end if
+        }
+        else if (strcmp(argv[arg], "--tol") == 0 && arg + 1 < argc)
+        {
+            options.tol = atof(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "--cycles") == 0 && arg + 1 < argc)
+        {
+            options.maxiter = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--smooth") == 0 && arg + 1 < argc)
+        {
+            options.pre_smooth = std::max(0, atoi(argv[++arg]));
+            options.post_smooth = options.pre_smooth;
+        }
+        else
+        {
+            fprintf(stderr, usage, argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+
+    // [A]:Platform, Device, Context and Queue (see cl_runtime.h)
+    clp::Runtime& runtime = clp::Runtime::instance();
+    runtime.print_selection();
+
+    const cl::Context& context = runtime.context();
+    cl::CommandQueue& queue = runtime.queue();
+
+    // [B]:Grid Hierarchy
+    std::unique_ptr<clp::Multigrid> mg;
+    try
+    {
+        mg.reset(new clp::Multigrid(n, dims > 1 ? n : 0, dims > 2 ? n : 0, options));
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    const int rows = mg->fine_operator().rows();
+    printf("Grid: %d^%d = %d unknowns, %d levels\n", n, dims, rows, mg->levels());
+
+    // [C]:Right Hand Side and Initial Guess
+    std::vector<double> b(rows, 1.0);
+    std::vector<double> x(rows, 0.0);
+    cl::Buffer b_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double) * rows, b.data());
+    cl::Buffer x_buf(context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(double) * rows, x.data());
+
+    // [D]:V-Cycles
+    const auto start = std::chrono::steady_clock::now();
+    clp::SolveResult result = mg->solve(queue, b_buf, x_buf);
+    queue.enqueueReadBuffer(x_buf, CL_TRUE, 0, sizeof(double) * rows, x.data());
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Code executed successfully!" << std::endl;
+    printf("Cycles: %d (%s), residual = %e\n",
+           result.iterations,
+           result.converged ? "converged" : "not converged",
+           result.residual);
+    printf("Time: %.3f s, %.2f ns per unknown and cycle\n",
+           seconds,
+           1e9 * seconds / rows / std::max(1, result.iterations));
+    clp::BufferPool::instance().print_stats();
+
+    return result.converged ? 0 : 1;
+
+}  // END program
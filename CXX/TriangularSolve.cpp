@@ -0,0 +1,247 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Triangular Solves
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Triangular solves with many right-hand sides (see cl_triangular.h)	*
+ * 	benchmarked against the serial backsub/forwardsub of mylib.h.		*
+ *																		*
+ * Usage: TriangularSolve [N] [--nrhs R] [--grid M] [--block NB]		*
+ * 	Dense:  U X = B, U a random n x n upper triangle.					*
+ * 	Sparse: (D + L) X = B, the lower triangle of the 5-point Laplacian	*
+ * 			on an M x M grid (a Gauss-Seidel sweep), 2M - 1 levels.		*
+ ************************************************************************/
+
+#include "cl_runtime.h"
+#include "cl_sparse.h"
+#include "cl_triangular.h"
+#include "host_blas.h"
+#include "host_thread_pool.h"
+#include "mylib.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/************************************************************************
+ * Function Declarations 												*
+ ************************************************************************/
+
+double seconds_since(std::chrono::steady_clock::time_point start);
+double max_difference(const std::vector<double>& x, const std::vector<double>& y);
+clp::CsrMatrix laplacian_lower(int m);
+
+// end Function Declarations
+
+/************************************************************************
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [0]:Command Line Options
+    int n = 2048;
+    int nrhs = 16;
+    int grid = 256;
+    int block = 64;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "--nrhs") == 0 && arg + 1 < argc)
+        {
+            nrhs = std::max(1, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--grid") == 0 && arg + 1 < argc)
+        {
+            grid = std::max(2, atoi(argv[++arg]));
+        }
+        else if (strcmp(argv[arg], "--block") == 0 && arg + 1 < argc)
+        {
+            block = std::max(1, atoi(argv[++arg]));
+        }
+        else if (atoi(argv[arg]) > 0)
+        {
+            n = atoi(argv[arg]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [N] [--nrhs R] [--grid M] [--block NB]\n", argv[0]);
+            return 1;
+        }  // end if
+    }  // end arg
+
+    clp::Runtime& runtime = clp::Runtime::instance();
+    runtime.print_selection();
+    const cl::Context& context = runtime.context();
+    cl::CommandQueue& queue = runtime.queue();
+
+    // [A]:Dense Problem: well conditioned upper triangle, random B
+    std::vector<double> U(static_cast<size_t>(n) * n, 0.0);
+    std::vector<double> B(static_cast<size_t>(n) * nrhs);
+    srand(42);
+    for (int i = 0; i < n; i++)
+    {
+        U[i + static_cast<size_t>(n) * i] = 2.0 + rand() / (double)RAND_MAX;
+        for (int j = i + 1; j < n; j++)
+        {
+            U[j + static_cast<size_t>(n) * i] = (rand() / (double)RAND_MAX - 0.5) / sqrt(n);
+        }  // end j
+    }  // end i
+    for (double& b : B)
+    {
+        b = rand() / (double)RAND_MAX - 0.5;
+    }
+
+    // [B]:Serial backsub, one right-hand side at a time (the reference)
+    std::vector<double> X_serial(B.size());
+    std::vector<double> column(n), x(n);
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < nrhs; r++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            column[i] = B[r + static_cast<size_t>(nrhs) * i];
+        }  // end i
+        backsub(U.data(), x.data(), column.data(), n);
+        for (int i = 0; i < n; i++)
+        {
+            X_serial[r + static_cast<size_t>(nrhs) * i] = x[i];
+        }  // end i
+    }  // end r
+    const double serial_seconds = seconds_since(start);
+
+    // [C]:Blocked host trsm
+    std::vector<double> X_host = B;
+    start = std::chrono::steady_clock::now();
+    clp::host::trsm_upper(n, nrhs, U.data(), n, X_host.data(), nrhs);
+    const double host_seconds = seconds_since(start);
+
+    // [D]:Blocked device solve; U stays resident, only B moves
+    cl::Buffer U_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(double) * U.size(), U.data());
+    cl::Buffer B_buf(context, CL_MEM_READ_WRITE, sizeof(double) * B.size());
+    clp::DenseTriangularSolver dense(block);
+    std::vector<double> X_device(B.size());
+
+    queue.enqueueWriteBuffer(B_buf, CL_TRUE, 0, sizeof(double) * B.size(), B.data());
+    dense.solve(queue, clp::Triangle::Upper, false, n, nrhs, U_buf, n, B_buf, nrhs);  // Warm up
+    queue.enqueueWriteBuffer(B_buf, CL_TRUE, 0, sizeof(double) * B.size(), B.data());
+    start = std::chrono::steady_clock::now();
+    dense.solve(queue, clp::Triangle::Upper, false, n, nrhs, U_buf, n, B_buf, nrhs);
+    queue.finish();
+    const double device_seconds = seconds_since(start);
+    queue.enqueueReadBuffer(B_buf, CL_TRUE, 0, sizeof(double) * B.size(), X_device.data());
+
+    const double dense_flops = static_cast<double>(n) * n * nrhs;
+    printf("Dense upper solve, n = %d, nrhs = %d, block = %d\n", n, nrhs, dense.block());
+    printf("  Serial backsub : %10.4f s | %8.3f GFLOP/s\n", serial_seconds, dense_flops / serial_seconds * 1e-9);
+    printf("  Host trsm      : %10.4f s | %8.3f GFLOP/s | max |error| = %e\n",
+           host_seconds,
+           dense_flops / host_seconds * 1e-9,
+           max_difference(X_host, X_serial));
+    printf("  OpenCL trsm    : %10.4f s | %8.3f GFLOP/s | max |error| = %e\n",
+           device_seconds,
+           dense_flops / device_seconds * 1e-9,
+           max_difference(X_device, X_serial));
+
+    // [E]:Sparse Problem: one Gauss-Seidel sweep (D + L) X = B
+    const clp::CsrMatrix L = laplacian_lower(grid);
+    const int rows = L.rows;
+    std::vector<double> S(static_cast<size_t>(rows) * nrhs);
+    for (double& s : S)
+    {
+        s = rand() / (double)RAND_MAX - 0.5;
+    }
+    const clp::LevelSchedule schedule = clp::level_schedule(L, clp::Triangle::Lower);
+
+    std::vector<double> Y_serial = S;
+    clp::host::ThreadPool one_thread(1);
+    start = std::chrono::steady_clock::now();
+    clp::sptrsm(L, clp::Triangle::Lower, false, schedule, nrhs, Y_serial.data(), nrhs, one_thread);
+    const double sparse_serial_seconds = seconds_since(start);
+
+    std::vector<double> Y_host = S;
+    start = std::chrono::steady_clock::now();
+    clp::sptrsm(L, clp::Triangle::Lower, false, schedule, nrhs, Y_host.data(), nrhs);
+    const double sparse_host_seconds = seconds_since(start);
+
+    clp::SparseTriangularSolver sparse(L, clp::Triangle::Lower);
+    cl::Buffer S_buf(context, CL_MEM_READ_WRITE, sizeof(double) * S.size());
+    std::vector<double> Y_device(S.size());
+    queue.enqueueWriteBuffer(S_buf, CL_TRUE, 0, sizeof(double) * S.size(), S.data());
+    start = std::chrono::steady_clock::now();
+    sparse.solve(queue, nrhs, S_buf, nrhs);
+    queue.finish();
+    const double sparse_device_seconds = seconds_since(start);
+    queue.enqueueReadBuffer(S_buf, CL_TRUE, 0, sizeof(double) * S.size(), Y_device.data());
+
+    printf("Sparse lower solve, %d x %d grid (n = %d, nnz = %d), %d levels\n",
+           grid,
+           grid,
+           rows,
+           L.nnz(),
+           schedule.levels());
+    printf("  Host, 1 thread  : %10.4f s\n", sparse_serial_seconds);
+    printf("  Host, %2d threads: %10.4f s | max |error| = %e\n",
+           clp::host::ThreadPool::instance().size(),
+           sparse_host_seconds,
+           max_difference(Y_host, Y_serial));
+    printf("  OpenCL levels   : %10.4f s | max |error| = %e\n",
+           sparse_device_seconds,
+           max_difference(Y_device, Y_serial));
+
+    const double error = std::max({max_difference(X_host, X_serial),
+                                   max_difference(X_device, X_serial),
+                                   max_difference(Y_host, Y_serial),
+                                   max_difference(Y_device, Y_serial)});
+    return error < 1e-10 ? 0 : 1;
+
+}  // END program
+
+/************************************************************************
+ * Helpers																*
+ ************************************************************************/
+
+double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double max_difference(const std::vector<double>& x, const std::vector<double>& y)
+{
+    double diff = 0.0;
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        diff = std::max(diff, fabs(x[i] - y[i]));
+    }  // end i
+    return diff;
+}
+
+// D + L of the 5-point Laplacian (4 on the diagonal, -1 for the west and
+// 	south neighbours) on an m x m grid, rows numbered x fastest
+clp::CsrMatrix laplacian_lower(int m)
+{
+    clp::CsrMatrix L;
+    L.rows = m * m;
+    L.cols = m * m;
+    L.row_ptr.push_back(0);
+    for (int row = 0; row < m * m; row++)
+    {
+        if (row >= m)
+        {
+            L.col_idx.push_back(row - m);
+            L.values.push_back(-1.0);
+        }
+        if (row % m > 0)
+        {
+            L.col_idx.push_back(row - 1);
+            L.values.push_back(-1.0);
+        }
+        L.col_idx.push_back(row);
+        L.values.push_back(4.0);
+        L.row_ptr.push_back(L.nnz());
+    }  // end row
+    return L;
+}
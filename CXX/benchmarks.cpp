@@ -0,0 +1,663 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Kernel Benchmarks
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Google Benchmark suite over the CXX kernels, host path (host_blas.h,	*
+ * 	cl_sparse.h) next to the OpenCL path for each, and the threaded		*
+ * 	native backend (native_*, host_kernels.h) where it has one:			*
+ * 		add_arrays		c = a + b										*
+ * 		gemv			y = A x, dense									*
+ * 		gemm			C = A B, dense (cl_gemm.h)						*
+ * 		jacobi_sweep	one Jacobi sweep, 1-D Poisson CSR matrix		*
+ * 		residual		||b - Ax||_2, same matrix (cl_operator.h)		*
+ * 		jacobi_residual	jacobi_sweep and residual fused in one pass		*
+ * 		spmv			y = A x, same matrix							*
+ * 		numa_*			spmv and jacobi_sweep split over the NUMA nodes	*
+ * 						of the device, one row block per node, halo		*
+ * 						exchange included (cl_multidevice.h)			*
+ * 		lu				blocked LU with pivoting (cl_lu.h)				*
+ * 	The argument is the problem size, 1e3 .. 1e7: vector length for		*
+ * 	the vector and sparse kernels, matrix entries (n = sqrt) for the	*
+ * 	dense ones. Every run reports GB/s (compulsory traffic) and			*
+ * 	GFLOP/s counters; OpenCL runs are timed in wall-clock time up to	*
+ * 	the queue finishing.												*
+ *																		*
+ * Usage: benchmarks [--benchmark_filter=REGEX] [--benchmark_out=FILE]	*
+ * 	Results also go to clp_benchmarks.json (JSON) unless				*
+ * 	--benchmark_out names another file.									*
+ ************************************************************************/
+
+#include "cl_buffer_pool.h"
+#include "cl_gemm.h"
+#include "cl_lu.h"
+#include "cl_multidevice.h"
+#include "cl_operator.h"
+#include "cl_runtime.h"
+#include "cl_sparse.h"
+#include "host_blas.h"
+#include "host_kernels.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <string.h>
+
+/************************************************************************
+ * Helpers																*
+ ************************************************************************/
+
+static const int64_t kMinSize = 1000;
+static const int64_t kMaxSize = 10000000;
+
+static const char* kAddArraysSource =
+    "__kernel void cl_add_arrays("
+    "int n, const __global double *a, const __global double *b, __global double *c)"
+    "{"
+    "int i = get_global_id(0);"
+    "if (i < n){ c[i] = a[i] + b[i]; }"
+    "}";
+
+// Counters of one iteration: "bytes" of compulsory traffic and "flops"
+static void set_rates(benchmark::State& state, double bytes, double flops)
+{
+    state.counters["GB/s"] = benchmark::Counter(bytes * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["GFLOP/s"] = benchmark::Counter(flops * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Order of the square matrix with about "entries" entries
+static int dense_order(int64_t entries)
+{
+    return std::max(1, static_cast<int>(std::lround(std::sqrt(static_cast<double>(entries)))));
+}
+
+// Row-major n x n, strictly diagonally dominant: LU needs no luck
+static std::vector<double> dominant_matrix(int n)
+{
+    std::vector<double> A(static_cast<std::size_t>(n) * n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            A[j + static_cast<std::size_t>(n) * i] = i == j ? 2.0 * n : 1.0 / (1 + (i + 2 * j) % 7);
+        }  // end j
+    }  // end i
+    return A;
+}
+
+// Pooled device buffer holding a copy of "host", leased like the solvers'
+// 	own buffers so the suite measures the allocator the binaries use
+static clp::BufferLease device_copy(const std::vector<double>& host, cl_mem_flags flags = CL_MEM_READ_WRITE)
+{
+    clp::BufferLease lease = clp::BufferPool::instance().acquire(sizeof(double) * host.size(), flags);
+    clp::Runtime::instance().queue().enqueueWriteBuffer(
+        lease.buffer(), CL_TRUE, 0, sizeof(double) * host.size(), host.data());
+    return lease;
+}
+
+// False (and the run marked as skipped) when no OpenCL device is usable
+static bool device_ready(benchmark::State& state)
+{
+    try
+    {
+        clp::Runtime::instance();
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(e.what());
+        return false;
+    }
+}
+
+// Traffic and work of one pass over the 1-D Poisson CSR matrix, reading
+// 	the matrix, b and x and writing one vector
+static double csr_bytes(const clp::CsrMatrix& A)
+{
+    return (sizeof(double) + sizeof(int)) * A.nnz() + sizeof(int) * (A.rows + 1) + 3.0 * sizeof(double) * A.rows;
+}
+
+/************************************************************************
+ * Add Arrays															*
+ ************************************************************************/
+
+static void host_add_arrays(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    std::vector<double> a(n, 1.0);
+    std::vector<double> b(n, 2.0);
+    std::vector<double> c(n);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            c[i] = a[i] + b[i];
+        }  // end i
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 3.0 * sizeof(double) * n, n);
+}
+
+static void cl_add_arrays(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    cl::Kernel kernel(clp::build_program(kAddArraysSource), "cl_add_arrays");
+    clp::BufferLease a = device_copy(std::vector<double>(n, 1.0), CL_MEM_READ_ONLY);
+    clp::BufferLease b = device_copy(std::vector<double>(n, 2.0), CL_MEM_READ_ONLY);
+    clp::BufferLease c = device_copy(std::vector<double>(n, 0.0), CL_MEM_WRITE_ONLY);
+    kernel.setArg(0, n);
+    kernel.setArg(1, a.buffer());
+    kernel.setArg(2, b.buffer());
+    kernel.setArg(3, c.buffer());
+    for (auto _ : state)
+    {
+        queue.enqueueNDRangeKernel(kernel, cl::NullRange, cl::NDRange(n));
+        queue.finish();
+    }
+    set_rates(state, 3.0 * sizeof(double) * n, n);
+}
+
+static void native_add_arrays(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::host::AlignedVector<double> a(n, 1.0);
+    const clp::host::AlignedVector<double> b(n, 2.0);
+    clp::host::AlignedVector<double> c(n);
+    for (auto _ : state)
+    {
+        clp::host::add_arrays(n, a.data(), b.data(), c.data());
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 3.0 * sizeof(double) * n, n);
+}
+
+/************************************************************************
+ * GEMV																	*
+ ************************************************************************/
+
+static void host_gemv(benchmark::State& state)
+{
+    const int n = dense_order(state.range(0));
+    const std::vector<double> A = dominant_matrix(n);
+    const std::vector<double> x(n, 1.0);
+    std::vector<double> y(n);
+    for (auto _ : state)
+    {
+        clp::host::gemv(n, n, 1.0, A.data(), n, x.data(), 0.0, y.data());
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, sizeof(double) * (static_cast<double>(n) * n + 2.0 * n), 2.0 * n * n);
+}
+
+static void cl_gemv(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = dense_order(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    clp::DenseOperator<double> A(dominant_matrix(n).data(), n);
+    clp::BufferLease x = device_copy(std::vector<double>(n, 1.0));
+    clp::BufferLease y = device_copy(std::vector<double>(n, 0.0));
+    for (auto _ : state)
+    {
+        A.apply(queue, x.buffer(), y.buffer());
+        queue.finish();
+    }
+    set_rates(state, sizeof(double) * (static_cast<double>(n) * n + 2.0 * n), 2.0 * n * n);
+}
+
+/************************************************************************
+ * GEMM																	*
+ ************************************************************************/
+
+static void host_gemm(benchmark::State& state)
+{
+    const int n = dense_order(state.range(0));
+    const std::vector<double> A = dominant_matrix(n);
+    const std::vector<double> B = dominant_matrix(n);
+    std::vector<double> C(static_cast<std::size_t>(n) * n);
+    for (auto _ : state)
+    {
+        clp::host::gemm(n, n, n, 1.0, A.data(), n, B.data(), n, 0.0, C.data(), n);
+        benchmark::DoNotOptimize(C.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 3.0 * sizeof(double) * n * n, 2.0 * n * n * static_cast<double>(n));
+}
+
+static void cl_gemm(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = dense_order(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    clp::Dgemm gemm(clp::tuned_gemm_config<double>(n, n, n));
+    clp::BufferLease A = device_copy(dominant_matrix(n), CL_MEM_READ_ONLY);
+    clp::BufferLease B = device_copy(dominant_matrix(n), CL_MEM_READ_ONLY);
+    clp::BufferLease C = device_copy(std::vector<double>(static_cast<std::size_t>(n) * n, 0.0));
+    for (auto _ : state)
+    {
+        gemm(queue, n, n, n, 1.0, A.buffer(), B.buffer(), 0.0, C.buffer());
+        queue.finish();
+    }
+    set_rates(state, 3.0 * sizeof(double) * n * n, 2.0 * n * n * static_cast<double>(n));
+}
+
+static void native_gemm(benchmark::State& state)
+{
+    const int n = dense_order(state.range(0));
+    const std::vector<double> A = dominant_matrix(n);
+    const std::vector<double> B = dominant_matrix(n);
+    std::vector<double> C(static_cast<std::size_t>(n) * n);
+    for (auto _ : state)
+    {
+        clp::host::parallel_gemm(n, n, n, 1.0, A.data(), n, B.data(), n, 0.0, C.data(), n);
+        benchmark::DoNotOptimize(C.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 3.0 * sizeof(double) * n * n, 2.0 * n * n * static_cast<double>(n));
+}
+
+/************************************************************************
+ * Jacobi Sweep															*
+ ************************************************************************/
+
+static void host_jacobi_sweep(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix A = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    const std::vector<double> b(n, 1.0);
+    const std::vector<double> x(n, 0.5);
+    std::vector<double> x_next(n);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            double diag = 1.0;
+            double sum = b[i];
+            for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+            {
+                if (A.col_idx[p] == i)
+                {
+                    diag = A.values[p];
+                }
+                else
+                {
+                    sum -= A.values[p] * x[A.col_idx[p]];
+                }
+            }  // end p
+            x_next[i] = sum / diag;
+        }  // end i
+        benchmark::DoNotOptimize(x_next.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, csr_bytes(A), 2.0 * A.nnz() + n);
+}
+
+static void cl_jacobi_sweep(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    const clp::CsrMatrix csr = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    clp::CsrOperator<double> A(csr);
+    clp::BufferLease b = device_copy(std::vector<double>(n, 1.0), CL_MEM_READ_ONLY);
+    clp::BufferLease x = device_copy(std::vector<double>(n, 0.5));
+    clp::BufferLease x_next = device_copy(std::vector<double>(n, 0.0));
+    for (auto _ : state)
+    {
+        A.jacobi_sweep(queue, b.buffer(), x.buffer(), x_next.buffer());
+        queue.finish();
+    }
+    set_rates(state, csr_bytes(csr), 2.0 * csr.nnz() + n);
+}
+
+static void native_jacobi_sweep(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix A = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    const clp::host::AlignedVector<double> b(n, 1.0);
+    const clp::host::AlignedVector<double> x(n, 0.5);
+    clp::host::AlignedVector<double> x_next(n);
+    for (auto _ : state)
+    {
+        clp::host::jacobi_sweep_csr(A, b.data(), x.data(), x_next.data());
+        benchmark::DoNotOptimize(x_next.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, csr_bytes(A), 2.0 * A.nnz() + n);
+}
+
+/************************************************************************
+ * Residual Reduction													*
+ ************************************************************************/
+
+static void host_residual(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix A = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    const std::vector<double> b(n, 1.0);
+    const std::vector<double> x(n, 0.5);
+    for (auto _ : state)
+    {
+        double sq = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            double r = b[i];
+            for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+            {
+                r -= A.values[p] * x[A.col_idx[p]];
+            }  // end p
+            sq += r * r;
+        }  // end i
+        benchmark::DoNotOptimize(std::sqrt(sq));
+    }
+    // No vector is written back, only the scalar
+    set_rates(state, csr_bytes(A) - sizeof(double) * n, 2.0 * A.nnz() + 3.0 * n);
+}
+
+static void cl_residual(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    const clp::CsrMatrix csr = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    clp::CsrOperator<double> A(csr);
+    clp::ResidualNorms norms(A);
+    clp::BufferLease b = device_copy(std::vector<double>(n, 1.0), CL_MEM_READ_ONLY);
+    clp::BufferLease x = device_copy(std::vector<double>(n, 0.5), CL_MEM_READ_ONLY);
+    for (auto _ : state)
+    {
+        // Blocks on the scalar read back
+        benchmark::DoNotOptimize(norms(queue, A, b.buffer(), x.buffer(), clp::Norm::Two));
+    }
+    set_rates(state, csr_bytes(csr) - sizeof(double) * n, 2.0 * csr.nnz() + 3.0 * n);
+}
+
+static void cl_jacobi_residual(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    const clp::CsrMatrix csr = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    clp::CsrOperator<double> A(csr);
+    clp::ResidualNorms norms(A);
+    clp::BufferLease b = device_copy(std::vector<double>(n, 1.0), CL_MEM_READ_ONLY);
+    clp::BufferLease x = device_copy(std::vector<double>(n, 0.5));
+    clp::BufferLease x_next = device_copy(std::vector<double>(n, 0.0));
+    for (auto _ : state)
+    {
+        // One pass over A for what jacobi_sweep + residual read twice
+        benchmark::DoNotOptimize(norms.sweep(queue, A, b.buffer(), x.buffer(), x_next.buffer(), clp::Norm::Two));
+    }
+    set_rates(state, csr_bytes(csr), 2.0 * csr.nnz() + 4.0 * n);
+}
+
+static void native_residual(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix A = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    const clp::host::AlignedVector<double> b(n, 1.0);
+    const clp::host::AlignedVector<double> x(n, 0.5);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(clp::host::residual_csr(A, b.data(), x.data()).two);
+    }
+    set_rates(state, csr_bytes(A) - sizeof(double) * n, 2.0 * A.nnz() + 3.0 * n);
+}
+
+/************************************************************************
+ * Sparse Matrix-Vector Product											*
+ ************************************************************************/
+
+static void host_spmv(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix A = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    const std::vector<double> x(n, 0.5);
+    std::vector<double> y(n);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            double sum = 0.0;
+            for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+            {
+                sum += A.values[p] * x[A.col_idx[p]];
+            }  // end p
+            y[i] = sum;
+        }  // end i
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    // No right hand side is read
+    set_rates(state, csr_bytes(A) - sizeof(double) * n, 2.0 * A.nnz());
+}
+
+static void cl_spmv(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    cl::CommandQueue& queue = clp::Runtime::instance().queue();
+    const clp::CsrMatrix csr = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    clp::CsrOperator<double> A(csr);
+    clp::BufferLease x = device_copy(std::vector<double>(n, 0.5), CL_MEM_READ_ONLY);
+    clp::BufferLease y = device_copy(std::vector<double>(n, 0.0));
+    for (auto _ : state)
+    {
+        A.apply(queue, x.buffer(), y.buffer());
+        queue.finish();
+    }
+    set_rates(state, csr_bytes(csr) - sizeof(double) * n, 2.0 * csr.nnz());
+}
+
+static void native_spmv(benchmark::State& state)
+{
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix A = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    const clp::host::AlignedVector<double> x(n, 0.5);
+    clp::host::AlignedVector<double> y(n);
+    for (auto _ : state)
+    {
+        clp::host::spmv_csr(A, x.data(), y.data());
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, csr_bytes(A) - sizeof(double) * n, 2.0 * A.nnz());
+}
+
+/************************************************************************
+ * NUMA Domains															*
+ ************************************************************************/
+
+// The runtime's device split into its NUMA nodes; the label records how
+// 	many there were, 1 meaning the device could not be split
+static clp::DeviceGroup numa_group(benchmark::State& state)
+{
+    clp::DeviceGroup group = clp::DeviceGroup::numa_domains(clp::Runtime::instance().device());
+    state.SetLabel(std::to_string(group.size()) + " NUMA domains");
+    return group;
+}
+
+static void cl_numa_spmv(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix csr = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    clp::DeviceGroup group = numa_group(state);
+    clp::DistributedCsr A(group, csr);
+    clp::DeviceVector x = A.make_vector(std::vector<double>(n, 0.5));
+    clp::DeviceVector y = A.make_vector();
+    for (auto _ : state)
+    {
+        A.exchange(x);
+        A.apply(x, y);
+        group.finish();
+    }
+    set_rates(state, csr_bytes(csr) - sizeof(double) * n, 2.0 * csr.nnz());
+}
+
+static void cl_numa_jacobi_sweep(benchmark::State& state)
+{
+    if (!device_ready(state))
+    {
+        return;
+    }
+    const int n = static_cast<int>(state.range(0));
+    const clp::CsrMatrix csr = clp::tridiagonal_csr(n, -1.0, 2.0, -1.0);
+    clp::DeviceGroup group = numa_group(state);
+    clp::DistributedCsr A(group, csr);
+    clp::DeviceVector b = A.make_vector(std::vector<double>(n, 1.0));
+    clp::DeviceVector x = A.make_vector(std::vector<double>(n, 0.5));
+    clp::DeviceVector x_next = A.make_vector();
+    for (auto _ : state)
+    {
+        A.exchange(x);
+        A.jacobi_sweep(b, x, x_next);
+        group.finish();
+    }
+    set_rates(state, csr_bytes(csr), 2.0 * csr.nnz() + n);
+}
+
+/************************************************************************
+ * LU																	*
+ ************************************************************************/
+
+// device_update selects the path; the matrix is restored outside the timing
+static void run_lu(benchmark::State& state, bool device_update)
+{
+    const int n = dense_order(state.range(0));
+    const std::vector<double> A0 = dominant_matrix(n);
+    std::vector<double> A(A0.size());
+    std::vector<int> ipiv;
+    clp::LuOptions options;
+    options.device_update = device_update;
+    clp::DenseLu lu(options);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::copy(A0.begin(), A0.end(), A.begin());
+        state.ResumeTiming();
+        lu.factor(n, A.data(), n, ipiv);
+        benchmark::DoNotOptimize(A.data());
+    }
+    set_rates(state, 2.0 * sizeof(double) * n * n, 2.0 / 3.0 * n * n * static_cast<double>(n));
+}
+
+static void host_lu(benchmark::State& state)
+{
+    run_lu(state, false);
+}
+
+static void cl_lu(benchmark::State& state)
+{
+    if (device_ready(state))
+    {
+        run_lu(state, true);
+    }
+}
+
+/************************************************************************
+ * Registration															*
+ ************************************************************************/
+
+#define CLP_HOST_BENCHMARK(fn) \
+    BENCHMARK(fn)->RangeMultiplier(10)->Range(kMinSize, kMaxSize)->Unit(benchmark::kMicrosecond)
+#define CLP_DEVICE_BENCHMARK(fn) CLP_HOST_BENCHMARK(fn)->UseRealTime()
+#define CLP_NATIVE_BENCHMARK(fn) CLP_HOST_BENCHMARK(fn)->UseRealTime()  // Pool threads
+
+CLP_HOST_BENCHMARK(host_add_arrays);
+CLP_DEVICE_BENCHMARK(cl_add_arrays);
+CLP_NATIVE_BENCHMARK(native_add_arrays);
+CLP_HOST_BENCHMARK(host_gemv);
+CLP_DEVICE_BENCHMARK(cl_gemv);
+CLP_HOST_BENCHMARK(host_gemm);
+CLP_DEVICE_BENCHMARK(cl_gemm);
+CLP_NATIVE_BENCHMARK(native_gemm);
+CLP_HOST_BENCHMARK(host_jacobi_sweep);
+CLP_DEVICE_BENCHMARK(cl_jacobi_sweep);
+CLP_NATIVE_BENCHMARK(native_jacobi_sweep);
+CLP_HOST_BENCHMARK(host_residual);
+CLP_DEVICE_BENCHMARK(cl_residual);
+CLP_DEVICE_BENCHMARK(cl_jacobi_residual);
+CLP_NATIVE_BENCHMARK(native_residual);
+CLP_HOST_BENCHMARK(host_spmv);
+CLP_DEVICE_BENCHMARK(cl_spmv);
+CLP_NATIVE_BENCHMARK(native_spmv);
+CLP_DEVICE_BENCHMARK(cl_numa_spmv);
+CLP_DEVICE_BENCHMARK(cl_numa_jacobi_sweep);
+CLP_HOST_BENCHMARK(host_lu)->UseRealTime();  // Threaded panels
+CLP_DEVICE_BENCHMARK(cl_lu);
+
+/************************************************************************
+ * Main Program 															*
+ ************************************************************************/
+
+int main(int argc, char** argv)
+{
+    // [A]:JSON next to the console table unless another file is named
+    std::vector<char*> args(argv, argv + argc);
+    std::string out = "--benchmark_out=clp_benchmarks.json";
+    bool named = false;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        named = named || strncmp(argv[arg], "--benchmark_out=", 16) == 0;
+    }  // end arg
+    if (!named)
+    {
+        args.push_back(&out[0]);
+    }
+    int count = static_cast<int>(args.size());
+
+    // [B]:Record where the numbers came from
+    benchmark::AddCustomContext("host_isa", clp::host::isa_name(clp::host::active_isa()));
+    try
+    {
+        benchmark::AddCustomContext("opencl_device", clp::Runtime::instance().device().getInfo<CL_DEVICE_NAME>());
+    }
+    catch (const std::exception& e)
+    {
+        benchmark::AddCustomContext("opencl_device", std::string("none (") + e.what() + ")");
+    }
+
+    // [C]:Run
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}  // END program
@@ -1,35 +1,55 @@
 // Alejandro Valencia
 // OpenCL-Projects: opencl test C++
 // Start: 25 May, 2019
-// Update: 25 May, 2019
+// Update: 18 October, 2026
 
 /************************************************************************
  * This code serves as a test bench for OpenCL Projects in C++ 			*
+ *																		*
+ * Usage: cl_add_arrays [n]												*
+ * 	The local size and the number of elements per work-item (VEC) are	*
+ * 	picked by the auto-tuner (see cl_autotune.h). Without a usable		*
+ * 	OpenCL device (or with CLP_BACKEND=native) the threaded host loop	*
+ * 	of host_kernels.h adds the arrays instead.							*
  ************************************************************************/
 
-#define CL_HPP_ENABLE_EXCEPTIONS
-#define CL_HPP_TARGET_OPENCL_VERSION 200
-
-#include <CL/opencl.hpp>
+#include "cl_autotune.h"
+#include "cl_buffer.h"
+#include "cl_profiler.h"
+#include "cl_runtime.h"
+#include "host_kernels.h"
 #include <iostream>
+#include <map>
+#include <string>
 #include <vector>
 #include <stdio.h>
 #include <stdlib.h>
 
 /************************************************************************
- * Function Declarations *
+ * Kernel Source 														*
  ************************************************************************/
 
-int print_platforms(int, std::vector<cl::Platform>);
-
-// end Function Declarations
+// Each work-item adds VEC consecutive elements; VEC is a build option
+static const char* kAddArraysSource =
+    "#ifndef VEC\n"
+    "#define VEC 1\n"
+    "#endif\n"
+    "__kernel void cl_add_arrays("
+    "int n, const __global int *a, const __global int *b, __global int *c)"
+    "{"
+    "int base = get_global_id(0)*VEC;"
+    "for (int v = 0; v < VEC; v++){"
+    "int i = base + v;"
+    "if (i < n){ c[i] = a[i] + b[i]; }"
+    "}"
+    "}";
 
 /************************************************************************
  * Main Program
  **
  ************************************************************************/
 
-int main()
+int main(int argc, char** argv)
 {
     // printf("OpenCL C++ library found!\n");
     // std::cout<<"C++ OpenCL ver 2 check" << std::endl;
@@ -37,119 +57,153 @@ int main()
     cl_int err;
 
     // [A]:Problem Setup
-    int a[4] = {1, 2, 3, 4};
-    int b[4] = {1, 2, 3, 4};
-    int c[4];
-
-    // [B]:Create Platform Object
-    // Filter for a 2.0 platform and set it as the default
-    std::vector<cl::Platform> platforms;  // Declare "platforms" as std type vector cl type Platform
-    cl::Platform::get(&platforms);        // Using scope cd::Platform get all platforms and place in variable platforms
-
-    int num_platforms = platforms.size();  // Use platform.size() to get number of platforms
-    std::cout << "Number of Platforms: " << num_platforms << std::endl;  // Print number of platforms
-
-    // [B.1]:Print Platform Atributions
-    print_platforms(num_platforms, platforms);
-
-    // [C]:Get Devices for Said Platforms
-    // NOTE: During debugging, platform[0], name "Clover", was found to have no devices.
-    // 	Therefore, automatically set platform to platform[1]
-
-    auto platform = platforms[0];
-
-    std::vector<cl::Device> devices;                          // Declare "devices" as a std type vector cl type Device
-    err = platform.getDevices(CL_DEVICE_TYPE_ALL, &devices);  // Get ALL devices associated with Intel CPU Runtime
-    std::cout << "Device on platform error = " << err << std::endl;
-
-    // Print Number of devices on Platform 1 - Intel CPU Runtime
-    std::cout << "Number of devices on " << platform.getInfo<CL_PLATFORM_NAME>() << " is " << devices.size() << "\n"
-              << std::endl;
-
-    // Get device
-    auto device = devices[0];
-    auto device_name = device.getInfo<CL_DEVICE_NAME>();
-    std::cout << "Device Name: " << device_name << "\n" << std::endl;
-
-    // [D]:Create Context and Queue for Device
-    cl::Context context(device);
-    cl::CommandQueue queue(context, device, 0, &err);
-    std::cout << "Creating queue error = " << err << std::endl;
-    err = queue.getInfo<CL_QUEUE_PROPERTIES>();
-    std::cout << "Queue properties error = " << err << std::endl;
-
-    // [E]:Create Memory Buffers
-    cl::Buffer a_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(int) * 4, a);
-    cl::Buffer b_buf(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(int) * 4, b);
-    cl::Buffer c_buf(context, CL_MEM_WRITE_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(int) * 4, c);
-
-    // [F]:Program and Kernel
-    // First write the kernel to be executed then build the program before
-    // 	setting the kernel
-    cl::Program program(context,
-                        "__kernel void cl_add_arrays("
-                        "const __global int *a, const __global int *b, __global int *c)"
-                        "{"
-                        "int gid = get_global_id(0);"
-                        "c[gid] = a[gid] + b[gid];"
-                        "}");
-    program.build("-cl-std=CL2.0");
-    //	program.build(device);
-
-    cl::Kernel kernel(program, "cl_add_arrays");
-
-    // [G]:Set Kernel Arguments
-    kernel.setArg(0, a_buf);
-    kernel.setArg(1, b_buf);
-    kernel.setArg(2, c_buf);
-
-    // [H]:Enqueue Kernel
-    cl::NDRange global(4);
-    cl::NDRange local(1);
-    err = queue.enqueueNDRangeKernel(kernel, cl::NullRange, global, local);
+    int n = argc > 1 ? atoi(argv[1]) : 4;
+    if (n < 1)
+    {
+        fprintf(stderr, "Usage: %s [n]\n", argv[0]);
+        return 1;
+    }
+
+    // Native backend: the same sum on the host threads, no OpenCL at all
+    bool native = false;
+    try
+    {
+        native = clp::select_backend() == clp::Backend::Native;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (native)
+    {
+        clp::host::AlignedVector<int> a(n), b(n), c(n);
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = i + 1;
+            b[i] = i + 1;
+        }
+        clp::host::add_arrays(n, a.data(), b.data(), c.data());
+        std::cout << "Code executed successfully! (native, " << clp::host::ThreadPool::instance().size()
+                  << " host threads)" << std::endl;
+
+        int errors = 0;
+        for (int i = 0; i < n; i++)
+        {
+            if (c[i] != 2 * (i + 1))
+            {
+                errors++;
+            }
+            if (i < 16)
+            {
+                std::cout << c[i] << std::endl;
+            }
+        }
+        if (errors)
+        {
+            std::cerr << errors << " wrong elements" << std::endl;
+        }
+        return errors ? 1 : 0;
+    }
+
+    // [B]:Platform, Device, Context and Queue
+    // Discovery and selection live in the shared runtime (see cl_runtime.h);
+    // 	set CLP_PLATFORM/CLP_DEVICE to pick something other than the first device
+    clp::Runtime& runtime = clp::Runtime::instance();
+    runtime.print_selection();
+    cl::CommandQueue& queue = runtime.queue();
+
+    // [C]:Create Memory Buffers
+    // On CPU devices these are the host arrays themselves (see cl_buffer.h),
+    // 	so filling them and reading c back copy nothing
+    clp::HostBuffer<int> a_buf(n, CL_MEM_READ_ONLY);
+    clp::HostBuffer<int> b_buf(n, CL_MEM_READ_ONLY);
+    clp::HostBuffer<int> c_buf(n, CL_MEM_WRITE_ONLY);
+    std::cout << "Buffers: " << clp::buffer_mode_name(a_buf.mode()) << std::endl;
+
+    int* a = a_buf.map(queue, CL_MAP_WRITE_INVALIDATE_REGION);
+    int* b = b_buf.map(queue, CL_MAP_WRITE_INVALIDATE_REGION);
+    for (int i = 0; i < n; i++)
+    {
+        a[i] = i + 1;
+        b[i] = i + 1;
+    }
+    a_buf.unmap(queue);
+    b_buf.unmap(queue);
+
+    // [D]:Program and Kernel
+    // One program per vector width; the binary cache makes rebuilds cheap
+    std::map<int, cl::Kernel> kernels;
+    auto kernel_for = [&](int vec) -> cl::Kernel& {
+        auto it = kernels.find(vec);
+        if (it == kernels.end())
+        {
+            cl::Program program =
+                clp::build_program(kAddArraysSource, "-cl-std=CL2.0 -DVEC=" + std::to_string(vec));
+            it = kernels.emplace(vec, cl::Kernel(program, "cl_add_arrays")).first;
+            it->second.setArg(0, n);
+            it->second.setArg(1, a_buf.buffer());
+            it->second.setArg(2, b_buf.buffer());
+            it->second.setArg(3, c_buf.buffer());
+        }
+        return it->second;
+    };
+
+    // [E]:Tune Local Size and Vector Width
+    const std::size_t max_local = runtime.device().getInfo<CL_DEVICE_MAX_WORK_GROUP_SIZE>();
+    std::vector<clp::TuneParams> candidates;
+    for (int vec : {1, 2, 4, 8, 16})
+    {
+        for (clp::TuneParams params : clp::local_size_candidates(max_local))
+        {
+            params["vec"] = vec;
+            candidates.push_back(params);
+        }
+    }
+
+    auto launch = [&](cl::CommandQueue& launch_queue, const clp::TuneParams& params) {
+        const int vec = params.at("vec");
+        const std::size_t items = (n + vec - 1) / vec;
+        cl::Event event;
+        launch_queue.enqueueNDRangeKernel(kernel_for(vec),
+                                          cl::NullRange,
+                                          cl::NDRange(clp::tuned_global_size(items, params)),
+                                          clp::tuned_local_range(params),
+                                          nullptr,
+                                          CLP_TRACE("cl_add_arrays", &event));
+        return event;
+    };
+    clp::TuneParams tuned = clp::AutoTuner::instance().tune("cl_add_arrays", n, candidates, launch);
+
+    // [F]:Enqueue Kernel
+    err = launch(queue, tuned).wait();
     std::cout << "Execute kernel error number = " << err << std::endl;
 
-    err = queue.enqueueReadBuffer(c_buf, CL_TRUE, 0, sizeof(int) * 4, c);
-    std::cout << "Reading result buffer error = " << err << std::endl;
+    // [G]:Map the Result
+    const int* c = c_buf.map(queue, CL_MAP_READ);
 
     // cl::finish();
 
     std::cout << "Code executed successfully!" << std::endl;
 
     int i;
-    for (i = 0; i < 4; i++)
+    int errors = 0;
+    for (i = 0; i < n; i++)
     {
-        std::cout << c[i] << std::endl;
+        if (c[i] != 2 * (i + 1))
+        {
+            errors++;
+        }
+        if (i < 16)
+        {
+            std::cout << c[i] << std::endl;
+        }
     }
-
-    return 0;
-}
-
-/************************************************************************
- * Print All Platforms Functions 										*
- ************************************************************************/
-
-int print_platforms(int num_platforms, std::vector<cl::Platform> platforms)
-{
-
-    int i;
-    for (i = 0; i < num_platforms; i++)
+    if (errors)
     {
+        std::cerr << errors << " wrong elements" << std::endl;
+    }
+    c_buf.unmap(queue);
 
-        auto platform_profile = platforms[i].getInfo<CL_PLATFORM_PROFILE>();
-        auto platform_name = platforms[i].getInfo<CL_PLATFORM_NAME>();
-        auto platform_vendor = platforms[i].getInfo<CL_PLATFORM_VENDOR>();
-        auto platform_version = platforms[i].getInfo<CL_PLATFORM_VERSION>();
-        auto platform_extensions = platforms[i].getInfo<CL_PLATFORM_EXTENSIONS>();
-
-        std::cout << "\nPlatform Profile: " << platform_profile << std::endl;
-        std::cout << "Platform Name: " << platform_name << std::endl;
-        std::cout << "Platform Vendor: " << platform_vendor << std::endl;
-        std::cout << "Platform Version " << platform_version << std::endl;
-        std::cout << "Platform Extensions: " << platform_extensions << "\n" << std::endl;
-
-    }  // end i
-
-    return 0;
-
-}  // end FUNCTION print_platforms
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,323 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Kernel Auto-Tuner
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_autotune.h"
+#include "cl_profiler.h"
+#include "cl_program_cache.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+
+namespace clp
+{
+namespace
+{
+
+// Timed launches per candidate after one untimed warm up
+const int kTimedRuns = 3;
+
+// First line of the results file. Version 2 keys the operators' kernels
+// 	by scalar ("cl_jacobi_csr<float>"); older files are ignored, since
+// 	their untyped entries would replay one build's result for the other
+const char* const kFileFormat = "# clp tuning 2";
+
+std::string format_params(const TuneParams& params)
+{
+    std::ostringstream out;
+    for (auto it = params.begin(); it != params.end(); ++it)
+    {
+        out << (it == params.begin() ? "" : ",") << it->first << "=" << it->second;
+    }
+    return out.str();
+}
+
+// False for anything but name=int items, so load() can skip the line
+bool parse_params(const std::string& text, TuneParams& params)
+{
+    std::stringstream in(text);
+    std::string item;
+    while (std::getline(in, item, ','))
+    {
+        std::size_t eq = item.find('=');
+        if (eq == std::string::npos || eq == 0)
+        {
+            return false;
+        }
+        const std::string value = item.substr(eq + 1);
+        char* end = nullptr;
+        errno = 0;
+        const long number = strtol(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || errno == ERANGE || number < std::numeric_limits<int>::min() ||
+            number > std::numeric_limits<int>::max())
+        {
+            return false;
+        }
+        params[item.substr(0, eq)] = static_cast<int>(number);
+    }
+    return true;
+}
+
+// False unless the whole field is a finite number
+bool parse_nanoseconds(const std::string& text, double& nanoseconds)
+{
+    char* end = nullptr;
+    errno = 0;
+    nanoseconds = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && errno != ERANGE && std::isfinite(nanoseconds);
+}
+
+std::string device_key()
+{
+    const cl::Device& device = Runtime::instance().device();
+    return device.getInfo<CL_DEVICE_NAME>() + " | " + device.getInfo<CL_DRIVER_VERSION>();
+}
+
+std::string default_path()
+{
+    const char* file = getenv("CLP_TUNE_FILE");
+    if (file && *file)
+    {
+        return file;
+    }
+    const std::string& cache = ProgramCache::instance().directory();
+    return cache.empty() ? "" : cache + "/tuning.txt";
+}
+
+bool default_sweep()
+{
+    const char* value = getenv("CLP_AUTOTUNE");
+    return !(value && (std::string(value) == "0" || std::string(value) == "off"));
+}
+
+}  // namespace
+
+/************************************************************************
+ * Auto-Tuner															*
+ ************************************************************************/
+
+AutoTuner::AutoTuner(std::string path, bool sweep) : path_(std::move(path)), sweep_(sweep)
+{
+    load();
+}
+
+AutoTuner& AutoTuner::instance()
+{
+    static AutoTuner tuner(default_path(), default_sweep());
+    return tuner;
+}
+
+std::size_t AutoTuner::bucket(std::size_t problem_size)
+{
+    std::size_t b = 1;
+    while (b < problem_size)
+    {
+        b *= 2;
+    }
+    return b;
+}
+
+TuneParams AutoTuner::tune(const std::string& kernel,
+                           std::size_t problem_size,
+                           const std::vector<TuneParams>& candidates,
+                           const TuneLaunch& launch)
+{
+    if (candidates.empty())
+    {
+        throw std::invalid_argument("AutoTuner: no candidates for " + kernel);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::string key = device_key() + "\t" + kernel + "\t" + std::to_string(bucket(problem_size));
+
+    // [A]:Stored result
+    auto found = entries_.find(key);
+    if (found != entries_.end())
+    {
+        return found->second.params;
+    }
+    if (!sweep_)
+    {
+        return candidates.front();
+    }
+
+    // [B]:Sweep, timing START->END of each launch on a profiling queue
+    cl::CommandQueue& queue = Runtime::instance().profiling_queue();
+    Entry best{candidates.front(), std::numeric_limits<double>::infinity()};
+
+    for (const TuneParams& candidate : candidates)
+    {
+        try
+        {
+            launch(queue, candidate).wait();
+
+            std::vector<double> times;
+            for (int run = 0; run < kTimedRuns; run++)
+            {
+                cl::Event event = launch(queue, candidate);
+                event.wait();
+                times.push_back(static_cast<double>(event.getProfilingInfo<CL_PROFILING_COMMAND_END>() -
+                                                    event.getProfilingInfo<CL_PROFILING_COMMAND_START>()));
+            }  // end run
+
+            std::sort(times.begin(), times.end());
+            const double median = times[times.size() / 2];
+            if (median < best.nanoseconds)
+            {
+                best = Entry{candidate, median};
+            }
+        }
+        catch (const cl::Error&)
+        {
+            // e.g. CL_INVALID_WORK_GROUP_SIZE or out of local memory
+            queue.finish();
+        }
+        catch (const std::invalid_argument&)
+        {
+            // Candidate rejected by the host wrapper before launch
+        }
+    }  // end candidate
+
+    std::cerr << "Auto-tuned " << kernel << " (n ~ " << bucket(problem_size) << "): " << format_params(best.params)
+              << std::endl;
+
+    entries_[key] = best;
+    save();
+    return best.params;
+}
+
+void AutoTuner::load()
+{
+    if (path_.empty())
+    {
+        return;
+    }
+
+    // Layout: the format line, then tab separated device, kernel, bucket,
+    // 	params, nanoseconds
+    std::ifstream file(path_);
+    std::string line;
+    if (!std::getline(file, line) || line != kFileFormat)
+    {
+        return;
+    }
+    while (std::getline(file, line))
+    {
+        std::vector<std::string> fields;
+        std::stringstream in(line);
+        std::string field;
+        while (std::getline(in, field, '\t'))
+        {
+            fields.push_back(field);
+        }
+        if (fields.size() != 5)
+        {
+            continue;
+        }
+        // Malformed lines are skipped like short ones: a bad tuning file
+        // 	costs a re-tune, never the kernels that read it
+        Entry entry;
+        if (!parse_params(fields[3], entry.params) || !parse_nanoseconds(fields[4], entry.nanoseconds))
+        {
+            continue;
+        }
+        const std::string key = fields[0] + "\t" + fields[1] + "\t" + fields[2];
+        entries_[key] = entry;
+    }  // end line
+}
+
+void AutoTuner::save() const
+{
+    if (path_.empty())
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path_).parent_path(), ec);
+
+    const std::string tmp = path_ + ".tmp";
+    {
+        std::ofstream file(tmp, std::ios::trunc);
+        if (!file)
+        {
+            return;
+        }
+        file << kFileFormat << "\n";
+        for (const auto& entry : entries_)
+        {
+            file << entry.first << "\t" << format_params(entry.second.params) << "\t" << entry.second.nanoseconds
+                 << "\n";
+        }
+    }
+    std::filesystem::rename(tmp, path_, ec);
+}
+
+/************************************************************************
+ * Candidate Helpers													*
+ ************************************************************************/
+
+std::vector<TuneParams> local_size_candidates(std::size_t limit)
+{
+    std::vector<TuneParams> candidates = {{{"local", 0}}};
+    for (std::size_t local = 1; local <= std::min<std::size_t>(limit, 1024); local *= 2)
+    {
+        candidates.push_back({{"local", static_cast<int>(local)}});
+    }
+    return candidates;
+}
+
+std::size_t tuned_global_size(std::size_t n, const TuneParams& params)
+{
+    auto it = params.find("local");
+    if (it == params.end() || it->second <= 0)
+    {
+        return n;
+    }
+    const std::size_t local = it->second;
+    return (n + local - 1) / local * local;
+}
+
+void TunedRange::enqueue(cl::CommandQueue& queue,
+                         const cl::Kernel& kernel,
+                         std::size_t n,
+                         const std::vector<cl::Event>* wait,
+                         cl::Event* event)
+{
+    if (tuned_n_ != n)
+    {
+        // The sweep runs on the profiling queue; let pending writes to the
+        // 	kernel's inputs land first
+        queue.finish();
+
+        const std::size_t limit = kernel.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(Runtime::instance().device());
+        params_ = AutoTuner::instance().tune(
+            name_, n, local_size_candidates(limit), [&](cl::CommandQueue& tune_queue, const TuneParams& params) {
+                cl::Event tune_event;
+                tune_queue.enqueueNDRangeKernel(kernel,
+                                                cl::NullRange,
+                                                cl::NDRange(tuned_global_size(n, params)),
+                                                tuned_local_range(params),
+                                                nullptr,
+                                                &tune_event);
+                return tune_event;
+            });
+        tuned_n_ = n;
+    }
+    queue.enqueueNDRangeKernel(kernel,
+                               cl::NullRange,
+                               cl::NDRange(tuned_global_size(n, params_)),
+                               tuned_local_range(params_),
+                               wait,
+                               CLP_TRACE(name_, event));
+}
+
+}  // namespace clp
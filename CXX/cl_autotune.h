@@ -0,0 +1,116 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Kernel Auto-Tuner
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Sweeps launch parameters (local size, tile size, vector width, ...)	*
+ * 	for a kernel, times every candidate with profiling events and		*
+ * 	remembers the fastest one per device and problem-size bucket in a	*
+ * 	plain text file. Later runs read the file and launch with the tuned	*
+ * 	configuration without sweeping again.								*
+ *																		*
+ * 	CLP_TUNE_FILE  results file (default <program cache dir>/tuning.txt)	*
+ * 	CLP_AUTOTUNE   set to 0/off to skip sweeps and use the first		*
+ * 				   (default) candidate unless a stored result exists	*
+ ************************************************************************/
+
+#ifndef CXX_CL_AUTOTUNE_H
+#define CXX_CL_AUTOTUNE_H
+
+#include "cl_runtime.h"
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace clp
+{
+
+// One point of the search space, e.g. {{"local", 64}, {"vec", 4}}
+using TuneParams = std::map<std::string, int>;
+
+// Enqueues one launch of the candidate on the given (profiling) queue and
+// 	returns the event of the timed command. May throw cl::Error or
+// 	std::invalid_argument for configurations the device rejects; those
+// 	candidates are skipped
+using TuneLaunch = std::function<cl::Event(cl::CommandQueue& queue, const TuneParams& params)>;
+
+class AutoTuner
+{
+  public:
+    // An empty path keeps results in memory only
+    AutoTuner(std::string path, bool sweep);
+
+    // Process-wide tuner configured from the environment
+    static AutoTuner& instance();
+
+    // Returns the stored best parameters for "kernel" at this problem size
+    // 	on the runtime's device, sweeping "candidates" first on a miss.
+    // 	candidates.front() is the fallback when nothing can be timed
+    TuneParams tune(const std::string& kernel,
+                    std::size_t problem_size,
+                    const std::vector<TuneParams>& candidates,
+                    const TuneLaunch& launch);
+
+    // Problem sizes are grouped by the next power of two
+    static std::size_t bucket(std::size_t problem_size);
+
+  private:
+    void load();
+    void save() const;
+
+    struct Entry
+    {
+        TuneParams params;
+        double nanoseconds;
+    };
+
+    std::string path_;
+    bool sweep_;
+    std::mutex mutex_;
+    std::map<std::string, Entry> entries_;  // "device\tkernel\tbucket" -> best
+};
+
+// Powers of two from 1 up to min(limit, 1024), plus 0 meaning "let the
+// 	runtime choose" (cl::NullRange)
+std::vector<TuneParams> local_size_candidates(std::size_t limit);
+
+// Turns a tuned "local" value back into an NDRange
+inline cl::NDRange tuned_local_range(const TuneParams& params)
+{
+    auto it = params.find("local");
+    return (it == params.end() || it->second <= 0) ? cl::NullRange : cl::NDRange(it->second);
+}
+
+// Rounds n up to a multiple of the tuned local size
+std::size_t tuned_global_size(std::size_t n, const TuneParams& params);
+
+// 1-D launch over n work-items whose local size is tuned on first use (and
+// 	again when n changes). The sweep reruns the kernel with its current
+// 	arguments, so only use it for kernels that are safe to repeat, e.g.
+// 	out-of-place sweeps or y = A*x. The name is the tuning key: give each
+// 	build of a kernel its own, e.g. "cl_jacobi_csr<float>"
+class TunedRange
+{
+  public:
+    explicit TunedRange(std::string kernel_name) : name_(std::move(kernel_name)) {}
+
+    void enqueue(cl::CommandQueue& queue,
+                 const cl::Kernel& kernel,
+                 std::size_t n,
+                 const std::vector<cl::Event>* wait = nullptr,
+                 cl::Event* event = nullptr);
+
+  private:
+    std::string name_;
+    std::size_t tuned_n_ = 0;
+    TuneParams params_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_AUTOTUNE_H
@@ -0,0 +1,355 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Batched Small-System Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* Many small, independent systems A_s x_s = b_s in one launch			*
+* 	(cl_batched.h). Work-group s solves system s: A_s starts at			*
+* 	A + s*strideA (row-major n x n), b_s and x_s likewise. The working	*
+* 	vectors live in local memory, so a system only touches global		*
+* 	memory for its own A, b and x.										*
+*																		*
+* 	Every kernel reports per system:									*
+* 	iterations[s] sweeps/steps taken (1 for LU, 0 if singular)			*
+* 	residual[s]   |b - Ax|_inf (Jacobi, LU) or |b - Ax|_2 (CG)			*
+* 	converged[s]  1 once residual < tol (LU: nonsingular), else 0		*
+* 	A work-group leaves as soon as its system has converged, freeing	*
+* 	the compute unit for the systems still iterating.					*
+************************************************************************/
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* Work-Group Reduction Helpers 											*
+************************************************************************/
+// Tree reductions over the work-group (local size a power of two); every
+// 	work-item must call them and gets the result. The first barrier keeps
+// 	the scratch from being overwritten while a previous result is read.
+double group_max(double v, __local double *red){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+	red[lid] = v;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			red[lid] = fmax(red[lid], red[lid+offset]);
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+	return red[0];
+}
+
+double group_sum(double v, __local double *red){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	barrier(CLK_LOCAL_MEM_FENCE);
+	red[lid] = v;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			red[lid] += red[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+	return red[0];
+}
+
+// Row i of A times the local vector v
+double row_dot(int n, int i, const __global double *A, const __local double *v){
+	double sum = 0.0;
+	int j;
+	for (j = 0; j < n; j++){
+		sum += A[j + n*i]*v[j];
+	}/*end j*/
+	return sum;
+}
+
+
+/************************************************************************
+* Jacobi 																*
+************************************************************************/
+// Local memory: 2n + local size doubles. The residual of the current
+// 	iterate falls out of the sweep, so every sweep is also a check.
+__kernel void cl_batch_jacobi(int n, int maxiter, double tol,
+							const __global double *A, int strideA, const __global double *b, int strideB,
+							__global double *x, int strideX, __global int *iterations,
+							__global double *residual, __global int *converged, __local double *scratch){
+	int s     = get_group_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+	A += (size_t)s*strideA;
+	b += (size_t)s*strideB;
+	x += (size_t)s*strideX;
+
+	__local double *xs  = scratch;
+	__local double *xn  = scratch + n;
+	__local double *red = scratch + 2*n;
+
+	//[A]:Initial guess
+	int i;
+	for (i = lid; i < n; i += lsize){
+		xs[i] = x[i];
+	}/*end i*/
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[B]:Sweep x_new = x + D^-1 (b - Ax) until |b - Ax| < tol
+	int it   = 0;
+	int done = 0;
+	double res;
+	for (;;){
+		double local_max = 0.0;
+		for (i = lid; i < n; i += lsize){
+			double r  = b[i] - row_dot(n, i, A, xs);
+			local_max = fmax(local_max, fabs(r));
+			xn[i]     = xs[i] + r/A[i + n*i];
+		}/*end i*/
+		res = group_max(local_max, red);
+		if (res < tol){
+			done = 1;
+			break;
+		}/*end if*/
+		if (it == maxiter){
+			break;
+		}/*end if*/
+
+		for (i = lid; i < n; i += lsize){
+			xs[i] = xn[i];
+		}/*end i*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+		it++;
+	}/*end for*/
+
+	//[C]:Results
+	for (i = lid; i < n; i += lsize){
+		x[i] = xs[i];
+	}/*end i*/
+	if (lid == 0){
+		iterations[s] = it;
+		residual[s]   = res;
+		converged[s]  = done;
+	}/*end if*/
+}
+
+
+/************************************************************************
+* Conjugate Gradient 													*
+************************************************************************/
+// Jacobi-preconditioned CG for symmetric positive definite A_s. Local
+// 	memory: 4n + local size doubles (x, r, p, q and the reduction).
+__kernel void cl_batch_cg(int n, int maxiter, double tol,
+						const __global double *A, int strideA, const __global double *b, int strideB,
+						__global double *x, int strideX, __global int *iterations,
+						__global double *residual, __global int *converged, __local double *scratch){
+	int s     = get_group_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+	A += (size_t)s*strideA;
+	b += (size_t)s*strideB;
+	x += (size_t)s*strideX;
+
+	__local double *xs  = scratch;
+	__local double *r   = scratch + n;
+	__local double *p   = scratch + 2*n;
+	__local double *q   = scratch + 3*n;
+	__local double *red = scratch + 4*n;
+
+	int i;
+	for (i = lid; i < n; i += lsize){
+		xs[i] = x[i];
+	}/*end i*/
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[A]:r = b - Ax, p = z = D^-1 r
+	double rr_l = 0.0;
+	double rz_l = 0.0;
+	for (i = lid; i < n; i += lsize){
+		r[i]  = b[i] - row_dot(n, i, A, xs);
+		p[i]  = r[i]/A[i + n*i];
+		rr_l += r[i]*r[i];
+		rz_l += r[i]*p[i];
+	}/*end i*/
+	double rr = group_sum(rr_l, red);
+	double rz = group_sum(rz_l, red);
+
+	//[B]:Iterate until |r|_2 < tol
+	int it   = 0;
+	int done = 0;
+	double res;
+	for (;;){
+		res = sqrt(rr);
+		if (res < tol){
+			done = 1;
+			break;
+		}/*end if*/
+		if (it == maxiter){
+			break;
+		}/*end if*/
+
+		// q = A p
+		double pq_l = 0.0;
+		for (i = lid; i < n; i += lsize){
+			q[i]  = row_dot(n, i, A, p);
+			pq_l += p[i]*q[i];
+		}/*end i*/
+		double pq = group_sum(pq_l, red);
+		if (!(pq > 0.0)){
+			break;	// A_s is not positive definite
+		}/*end if*/
+
+		// x += alpha p, r -= alpha q (each work-item only touches its rows)
+		double alpha = rz/pq;
+		rr_l = 0.0;
+		rz_l = 0.0;
+		for (i = lid; i < n; i += lsize){
+			xs[i] += alpha*p[i];
+			r[i]  -= alpha*q[i];
+			rr_l  += r[i]*r[i];
+			rz_l  += r[i]*r[i]/A[i + n*i];
+		}/*end i*/
+		rr = group_sum(rr_l, red);
+		double rz_new = group_sum(rz_l, red);
+
+		// p = z + beta p
+		double beta = rz_new/rz;
+		rz = rz_new;
+		for (i = lid; i < n; i += lsize){
+			p[i] = r[i]/A[i + n*i] + beta*p[i];
+		}/*end i*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+		it++;
+	}/*end for*/
+
+	//[C]:Results
+	for (i = lid; i < n; i += lsize){
+		x[i] = xs[i];
+	}/*end i*/
+	if (lid == 0){
+		iterations[s] = it;
+		residual[s]   = res;
+		converged[s]  = done;
+	}/*end if*/
+}
+
+
+/************************************************************************
+* LU With Partial Pivoting 												*
+************************************************************************/
+// Direct solve: factor a local copy of A_s, eliminating b alongside, then
+// 	back substitute. Local memory: n*n + n + local size doubles. x holds
+// 	no initial guess; tol and maxiter are unused.
+__kernel void cl_batch_lu(int n, int maxiter, double tol,
+						const __global double *A, int strideA, const __global double *b, int strideB,
+						__global double *x, int strideX, __global int *iterations,
+						__global double *residual, __global int *converged, __local double *scratch){
+	int s     = get_group_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+	A += (size_t)s*strideA;
+	b += (size_t)s*strideB;
+	x += (size_t)s*strideX;
+
+	__local double *M   = scratch;
+	__local double *y   = scratch + n*n;
+	__local double *red = scratch + n*n + n;
+	__local int pivot;
+
+	//[A]:Local copies of A and b
+	int i,j,k;
+	for (i = lid; i < n*n; i += lsize){
+		M[i] = A[i];
+	}/*end i*/
+	for (i = lid; i < n; i += lsize){
+		y[i] = b[i];
+	}/*end i*/
+
+	//[B]:Elimination, one column at a time
+	int singular = 0;
+	for (k = 0; k < n; k++){
+		barrier(CLK_LOCAL_MEM_FENCE);
+		if (lid == 0){
+			int p = k;
+			for (i = k+1; i < n; i++){
+				if (fabs(M[k + n*i]) > fabs(M[k + n*p])){
+					p = i;
+				}/*end if*/
+			}/*end i*/
+			pivot = M[k + n*p] == 0.0 ? -1 : p;
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+		int p = pivot;
+		if (p < 0){
+			singular = 1;
+			break;
+		}/*end if*/
+
+		// Row interchange, b included
+		if (p != k){
+			for (j = lid; j < n; j += lsize){
+				double tmp = M[j + n*k];
+				M[j + n*k] = M[j + n*p];
+				M[j + n*p] = tmp;
+			}/*end j*/
+			if (lid == 0){
+				double tmp = y[k];
+				y[k]       = y[p];
+				y[p]       = tmp;
+			}/*end if*/
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		// Multipliers, then the trailing update
+		for (i = k+1+lid; i < n; i += lsize){
+			M[k + n*i] /= M[k + n*k];
+			y[i]       -= M[k + n*i]*y[k];
+		}/*end i*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		int width = n - k - 1;
+		int e;
+		for (e = lid; e < width*width; e += lsize){
+			i = k + 1 + e/width;
+			j = k + 1 + e%width;
+			M[j + n*i] -= M[k + n*i]*M[j + n*k];
+		}/*end e*/
+	}/*end k*/
+
+	//[C]:Back substitution, one column of U at a time
+	if (!singular){
+		for (k = n-1; k >= 0; k--){
+			barrier(CLK_LOCAL_MEM_FENCE);
+			if (lid == 0){
+				y[k] /= M[k + n*k];
+			}/*end if*/
+			barrier(CLK_LOCAL_MEM_FENCE);
+			for (i = lid; i < k; i += lsize){
+				y[i] -= M[k + n*i]*y[k];
+			}/*end i*/
+		}/*end k*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+		for (i = lid; i < n; i += lsize){
+			x[i] = y[i];
+		}/*end i*/
+	}/*end if*/
+
+	//[D]:Residual against the original A_s
+	double local_max = 0.0;
+	for (i = lid; i < n && !singular; i += lsize){
+		local_max = fmax(local_max, fabs(b[i] - row_dot(n, i, A, y)));
+	}/*end i*/
+	double res = group_max(local_max, red);
+	if (lid == 0){
+		iterations[s] = singular ? 0 : 1;
+		residual[s]   = singular ? INFINITY : res;
+		converged[s]  = !singular;
+	}/*end if*/
+}
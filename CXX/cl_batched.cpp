@@ -0,0 +1,216 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Batched Small-System Solver
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_batched.h"
+#include "cl_buffer_pool.h"
+#include "cl_profiler.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace clp
+{
+namespace
+{
+
+// Work-items per system: enough for one row each, within reason
+const std::size_t kMaxLocal = 256;
+
+const char* kernel_name(BatchMethod method)
+{
+    switch (method)
+    {
+        case BatchMethod::Cg:
+            return "cl_batch_cg";
+        case BatchMethod::Lu:
+            return "cl_batch_lu";
+        default:
+            return "cl_batch_jacobi";
+    }
+}
+
+// A and b are only read, so their systems may overlap (stride 0 shares one
+// 	A or b across the batch); x may not
+void require_layout(int n, int batch, int strideA, int strideB, int strideX)
+{
+    if (n < 1 || batch < 0 || strideA < 0 || strideB < 0 || (batch > 1 && strideX < n))
+    {
+        throw std::invalid_argument("BatchedSolver: need n >= 1, batch >= 0, strides >= 0 and strideX >= n");
+    }
+}
+
+// Elements spanned by "batch" blocks of "size" elements, "stride" apart
+std::size_t span(int batch, int stride, int size)
+{
+    return static_cast<std::size_t>(batch - 1) * stride + size;
+}
+
+}  // namespace
+
+const char* batch_method_name(BatchMethod method)
+{
+    switch (method)
+    {
+        case BatchMethod::Cg:
+            return "CG";
+        case BatchMethod::Lu:
+            return "LU";
+        default:
+            return "Jacobi";
+    }
+}
+
+int BatchResult::converged_count() const
+{
+    return static_cast<int>(std::count(converged.begin(), converged.end(), 1));
+}
+
+/************************************************************************
+ * Batched Solver														*
+ ************************************************************************/
+
+BatchedSolver::BatchedSolver(BatchOptions options) : options_(options)
+{
+    const cl::Device& device = Runtime::instance().device();
+    kernel_ = cl::Kernel(build_program(load_kernel_source("cl_batched.cl")), kernel_name(options_.method));
+    group_limit_ = std::min(kMaxLocal, kernel_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device));
+
+    // Local memory left after the kernel's own __local variables
+    const std::size_t total = static_cast<std::size_t>(device.getInfo<CL_DEVICE_LOCAL_MEM_SIZE>());
+    const std::size_t used = static_cast<std::size_t>(kernel_.getWorkGroupInfo<CL_KERNEL_LOCAL_MEM_SIZE>(device));
+    local_memory_ = total > used ? total - used : 0;
+}
+
+std::size_t BatchedSolver::local_size(int n) const
+{
+    std::size_t local = 1;
+    while (local < static_cast<std::size_t>(n) && local * 2 <= group_limit_)
+    {
+        local *= 2;
+    }  // end while
+    return local;
+}
+
+std::size_t BatchedSolver::scratch_doubles(int n, std::size_t local) const
+{
+    const std::size_t rows = static_cast<std::size_t>(n);
+    switch (options_.method)
+    {
+        case BatchMethod::Cg:
+            return 4 * rows + local;
+        case BatchMethod::Lu:
+            return rows * rows + rows + local;
+        default:
+            return 2 * rows + local;
+    }
+}
+
+int BatchedSolver::max_size() const
+{
+    int n = 0;
+    while (sizeof(double) * scratch_doubles(n + 1, local_size(n + 1)) <= local_memory_)
+    {
+        n++;
+    }  // end while
+    return n;
+}
+
+BatchResult BatchedSolver::solve(cl::CommandQueue& queue,
+                                 int n,
+                                 int batch,
+                                 const cl::Buffer& A,
+                                 int strideA,
+                                 const cl::Buffer& b,
+                                 int strideB,
+                                 cl::Buffer& x,
+                                 int strideX)
+{
+    // [A]:Checks
+    require_layout(n, batch, strideA, strideB, strideX);
+    const std::size_t local = local_size(n);
+    if (sizeof(double) * scratch_doubles(n, local) > local_memory_)
+    {
+        throw std::invalid_argument("BatchedSolver: n = " + std::to_string(n) + " does not fit in local memory (" +
+                                    batch_method_name(options_.method) + " max_size() = " +
+                                    std::to_string(max_size()) + ")");
+    }
+
+    BatchResult result;
+    result.iterations.resize(batch);
+    result.residual.resize(batch);
+    result.converged.resize(batch);
+    if (batch == 0)
+    {
+        return result;
+    }
+
+    // [B]:One work-group per system
+    BufferPool& pool = BufferPool::instance();
+    BufferLease iterations = pool.acquire(sizeof(int) * batch, CL_MEM_WRITE_ONLY);
+    BufferLease residual = pool.acquire(sizeof(double) * batch, CL_MEM_WRITE_ONLY);
+    BufferLease converged = pool.acquire(sizeof(int) * batch, CL_MEM_WRITE_ONLY);
+
+    kernel_.setArg(0, n);
+    kernel_.setArg(1, options_.maxiter);
+    kernel_.setArg(2, options_.tol);
+    kernel_.setArg(3, A);
+    kernel_.setArg(4, strideA);
+    kernel_.setArg(5, b);
+    kernel_.setArg(6, strideB);
+    kernel_.setArg(7, x);
+    kernel_.setArg(8, strideX);
+    kernel_.setArg(9, iterations.buffer());
+    kernel_.setArg(10, residual.buffer());
+    kernel_.setArg(11, converged.buffer());
+    kernel_.setArg(12, cl::Local(sizeof(double) * scratch_doubles(n, local)));
+    queue.enqueueNDRangeKernel(kernel_,
+                               cl::NullRange,
+                               cl::NDRange(local * batch),
+                               cl::NDRange(local),
+                               nullptr,
+                               CLP_TRACE(batch_method_name(options_.method), nullptr));
+
+    // [C]:Per-system results
+    queue.enqueueReadBuffer(iterations.buffer(), CL_FALSE, 0, sizeof(int) * batch, result.iterations.data());
+    queue.enqueueReadBuffer(residual.buffer(), CL_FALSE, 0, sizeof(double) * batch, result.residual.data());
+    queue.enqueueReadBuffer(converged.buffer(), CL_TRUE, 0, sizeof(int) * batch, result.converged.data());
+    return result;
+}
+
+BatchResult BatchedSolver::solve(cl::CommandQueue& queue,
+                                 int n,
+                                 int batch,
+                                 const double* A,
+                                 int strideA,
+                                 const double* b,
+                                 int strideB,
+                                 double* x,
+                                 int strideX)
+{
+    require_layout(n, batch, strideA, strideB, strideX);
+    if (batch == 0)
+    {
+        return BatchResult();
+    }
+    const std::size_t a_bytes = sizeof(double) * span(batch, strideA, n * n);
+    const std::size_t b_bytes = sizeof(double) * span(batch, strideB, n);
+    const std::size_t x_bytes = sizeof(double) * span(batch, strideX, n);
+
+    // Pooled, so solving system after system does not create buffers
+    BufferPool& pool = BufferPool::instance();
+    BufferLease A_buf = pool.acquire(a_bytes, CL_MEM_READ_ONLY);
+    BufferLease b_buf = pool.acquire(b_bytes, CL_MEM_READ_ONLY);
+    BufferLease x_buf = pool.acquire(x_bytes, CL_MEM_READ_WRITE);
+    queue.enqueueWriteBuffer(A_buf.buffer(), CL_FALSE, 0, a_bytes, A);
+    queue.enqueueWriteBuffer(b_buf.buffer(), CL_FALSE, 0, b_bytes, b);
+    queue.enqueueWriteBuffer(x_buf.buffer(), CL_TRUE, 0, x_bytes, x);
+
+    BatchResult result =
+        solve(queue, n, batch, A_buf.buffer(), strideA, b_buf.buffer(), strideB, x_buf.buffer(), strideX);
+    queue.enqueueReadBuffer(x_buf.buffer(), CL_TRUE, 0, x_bytes, x);
+    return result;
+}
+
+}  // namespace clp
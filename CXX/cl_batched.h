@@ -0,0 +1,99 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Batched Small-System Solver
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Solves many small, independent dense systems A_s x_s = b_s with one	*
+ * 	kernel launch (cl_batched.cl): one work-group per system, so the	*
+ * 	context, buffer and launch costs are paid once per batch rather		*
+ * 	than once per system.												*
+ *																		*
+ * 	Systems are addressed by element strides: A_s = A + s*strideA		*
+ * 	(row-major n x n), b_s = b + s*strideB, x_s = x + s*strideX, so		*
+ * 	packed arrays and padded/interleaved layouts both work. Each		*
+ * 	system's working set must fit the device's local memory.			*
+ ************************************************************************/
+
+#ifndef CXX_CL_BATCHED_H
+#define CXX_CL_BATCHED_H
+
+#include "cl_runtime.h"
+#include <cstddef>
+#include <vector>
+
+namespace clp
+{
+
+enum class BatchMethod
+{
+    Jacobi = 0,  // Diagonally dominant A_s
+    Cg = 1,      // Symmetric positive definite A_s (Jacobi preconditioned)
+    Lu = 2       // Any nonsingular A_s (partial pivoting, direct)
+};
+
+const char* batch_method_name(BatchMethod method);
+
+struct BatchOptions
+{
+    BatchMethod method = BatchMethod::Jacobi;
+    double tol = 0.001;  // Residual tolerance of the iterative methods
+    int maxiter = 1000;  // Sweeps/steps per system
+};
+
+// Per-system outcome, indexed by system
+struct BatchResult
+{
+    std::vector<int> iterations;
+    std::vector<double> residual;  // |b - Ax|_inf, or |b - Ax|_2 for CG
+    std::vector<int> converged;    // 1 if residual < tol (LU: nonsingular)
+
+    int converged_count() const;
+};
+
+class BatchedSolver
+{
+  public:
+    explicit BatchedSolver(BatchOptions options = BatchOptions());
+
+    // Device arrays; x holds the initial guesses of the iterative methods
+    // 	and receives the solutions
+    BatchResult solve(cl::CommandQueue& queue,
+                      int n,
+                      int batch,
+                      const cl::Buffer& A,
+                      int strideA,
+                      const cl::Buffer& b,
+                      int strideB,
+                      cl::Buffer& x,
+                      int strideX);
+
+    // Host arrays: copied in, solved, and x copied back
+    BatchResult solve(cl::CommandQueue& queue,
+                      int n,
+                      int batch,
+                      const double* A,
+                      int strideA,
+                      const double* b,
+                      int strideB,
+                      double* x,
+                      int strideX);
+
+    // Largest n whose working set fits in local memory
+    int max_size() const;
+
+    const BatchOptions& options() const { return options_; }
+
+  private:
+    std::size_t local_size(int n) const;
+    std::size_t scratch_doubles(int n, std::size_t local) const;
+
+    BatchOptions options_;
+    cl::Kernel kernel_;
+    std::size_t group_limit_;
+    std::size_t local_memory_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_BATCHED_H
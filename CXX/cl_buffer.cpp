@@ -0,0 +1,234 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Host-Visible Buffers
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_buffer.h"
+#include "cl_profiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace clp
+{
+namespace
+{
+
+// Page alignment (and a size that is a whole number of pages) is what
+// 	the CPU runtimes need before they will use host storage in place
+const std::size_t kPage = 4096;
+
+std::size_t page_bytes(std::size_t bytes)
+{
+    return std::max(kPage, (bytes + kPage - 1) / kPage * kPage);
+}
+
+bool svm_buffers(const cl::Device& device)
+{
+    const std::string version = device.getInfo<CL_DEVICE_VERSION>();
+    if (version.compare(0, 9, "OpenCL 1.") == 0)
+    {
+        return false;
+    }
+    return (device.getInfo<CL_DEVICE_SVM_CAPABILITIES>() & CL_DEVICE_SVM_COARSE_GRAIN_BUFFER) != 0;
+}
+
+BufferMode pick_buffer_mode()
+{
+    const cl::Device& device = Runtime::instance().device();
+    const char* value = getenv("CLP_ZERO_COPY");
+    const std::string setting = value ? value : "";
+    if (setting == "0" || setting == "off")
+    {
+        return BufferMode::Copy;
+    }
+    if (!unified_memory(device))
+    {
+        return BufferMode::Copy;
+    }
+    if (setting == "svm" && svm_buffers(device))
+    {
+        return BufferMode::Svm;
+    }
+    return BufferMode::HostPtr;
+}
+
+}  // namespace
+
+const char* buffer_mode_name(BufferMode mode)
+{
+    switch (mode)
+    {
+        case BufferMode::HostPtr:
+            return "zero-copy (USE_HOST_PTR)";
+        case BufferMode::Svm:
+            return "zero-copy (SVM)";
+        default:
+            return "device copy";
+    }
+}
+
+bool unified_memory(const cl::Device& device)
+{
+    if (device.getInfo<CL_DEVICE_TYPE>() & CL_DEVICE_TYPE_CPU)
+    {
+        return true;
+    }
+
+    // Deprecated in OpenCL 2.0, so the C++ bindings no longer expose it
+    cl_bool unified = CL_FALSE;
+    if (clGetDeviceInfo(device(), CL_DEVICE_HOST_UNIFIED_MEMORY, sizeof(unified), &unified, nullptr) != CL_SUCCESS)
+    {
+        return false;
+    }
+    return unified == CL_TRUE;
+}
+
+BufferMode default_buffer_mode()
+{
+    static const BufferMode mode = pick_buffer_mode();
+    return mode;
+}
+
+/************************************************************************
+ * Host Buffer															*
+ ************************************************************************/
+
+template <typename T>
+HostBuffer<T>::HostBuffer(std::size_t count, cl_mem_flags access, BufferMode mode)
+    : count_(count), mode_(mode), host_(nullptr), mapped_(nullptr), mapped_flags_(0)
+{
+    if (count_ == 0)
+    {
+        throw std::invalid_argument("HostBuffer: count must be positive");
+    }
+    const cl::Context& context = Runtime::instance().context();
+    const std::size_t bytes = page_bytes(sizeof(T) * count_);
+
+    // [A]:Storage
+    if (mode_ == BufferMode::Svm)
+    {
+        host_ = static_cast<T*>(clSVMAlloc(context(), access, bytes, kPage));
+    }
+    else
+    {
+        host_ = static_cast<T*>(std::aligned_alloc(kPage, bytes));
+    }
+    if (!host_)
+    {
+        throw std::bad_alloc();
+    }
+
+    // [B]:Buffer: the storage itself, or a device-local copy of it
+    try
+    {
+        if (mode_ == BufferMode::Copy)
+        {
+            buffer_ = cl::Buffer(context, access, sizeof(T) * count_);
+        }
+        else
+        {
+            buffer_ = cl::Buffer(context, access | CL_MEM_USE_HOST_PTR, bytes, host_);
+        }
+    }
+    catch (...)
+    {
+        if (mode_ == BufferMode::Svm)
+        {
+            clSVMFree(context(), host_);
+        }
+        else
+        {
+            std::free(host_);
+        }
+        throw;
+    }
+}
+
+template <typename T>
+HostBuffer<T>::HostBuffer(const T* init, std::size_t count, cl_mem_flags access, BufferMode mode)
+    : HostBuffer(count, access, mode)
+{
+    cl::CommandQueue& queue = Runtime::instance().queue();
+    std::copy(init, init + count_, map(queue, CL_MAP_WRITE_INVALIDATE_REGION));
+    unmap(queue);
+}
+
+template <typename T>
+HostBuffer<T>::~HostBuffer()
+{
+    buffer_ = cl::Buffer();
+    if (mode_ == BufferMode::Svm)
+    {
+        clSVMFree(Runtime::instance().context()(), host_);
+    }
+    else
+    {
+        std::free(host_);
+    }
+}
+
+template <typename T>
+T* HostBuffer<T>::map(cl::CommandQueue& queue, cl_map_flags flags)
+{
+    if (mapped_)
+    {
+        throw std::logic_error("HostBuffer: already mapped");
+    }
+    const std::size_t bytes = sizeof(T) * count_;
+    switch (mode_)
+    {
+        case BufferMode::HostPtr:
+            mapped_ = static_cast<T*>(
+                queue.enqueueMapBuffer(buffer_, CL_TRUE, flags, 0, bytes, nullptr, CLP_TRACE("map", nullptr)));
+            break;
+        case BufferMode::Svm:
+            queue.enqueueMapSVM(host_, CL_TRUE, flags, bytes, nullptr, CLP_TRACE("map", nullptr));
+            mapped_ = host_;
+            break;
+        default:
+            if (flags & (CL_MAP_READ | CL_MAP_WRITE))
+            {
+                queue.enqueueReadBuffer(buffer_, CL_TRUE, 0, bytes, host_, nullptr, CLP_TRACE("map (copy)", nullptr));
+            }
+            mapped_ = host_;
+            break;
+    }
+    mapped_flags_ = flags;
+    return mapped_;
+}
+
+template <typename T>
+void HostBuffer<T>::unmap(cl::CommandQueue& queue)
+{
+    if (!mapped_)
+    {
+        return;
+    }
+    switch (mode_)
+    {
+        case BufferMode::HostPtr:
+            queue.enqueueUnmapMemObject(buffer_, mapped_, nullptr, CLP_TRACE("unmap", nullptr));
+            break;
+        case BufferMode::Svm:
+            queue.enqueueUnmapSVM(host_, nullptr, CLP_TRACE("unmap", nullptr));
+            break;
+        default:
+            if (mapped_flags_ & (CL_MAP_WRITE | CL_MAP_WRITE_INVALIDATE_REGION))
+            {
+                queue.enqueueWriteBuffer(
+                    buffer_, CL_TRUE, 0, sizeof(T) * count_, host_, nullptr, CLP_TRACE("unmap (copy)", nullptr));
+            }
+            break;
+    }
+    mapped_ = nullptr;
+    mapped_flags_ = 0;
+}
+
+template class HostBuffer<int>;
+template class HostBuffer<float>;
+template class HostBuffer<double>;
+
+}  // namespace clp
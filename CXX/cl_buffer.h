@@ -0,0 +1,95 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Host-Visible Buffers
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Device buffers the host reads and writes through map/unmap instead	*
+ * 	of explicit copies. On devices whose memory is host memory (CPU		*
+ * 	runtimes such as POCL or the Intel CPU runtime, integrated GPUs:	*
+ * 	CL_DEVICE_HOST_UNIFIED_MEMORY) the buffer is backed by page-aligned	*
+ * 	host storage (CL_MEM_USE_HOST_PTR) or an OpenCL 2.0 SVM allocation,	*
+ * 	so mapping hands back that storage and nothing is copied. On		*
+ * 	discrete devices it stays a device-local buffer, and map/unmap		*
+ * 	become a read into and a write from a host shadow.					*
+ *																		*
+ * 	The default mode is picked once per process from the runtime's		*
+ * 	device and CLP_ZERO_COPY: 0 forces copies, svm prefers SVM where	*
+ * 	the device supports coarse-grained SVM buffers.						*
+ ************************************************************************/
+
+#ifndef CXX_CL_BUFFER_H
+#define CXX_CL_BUFFER_H
+
+#include "cl_runtime.h"
+#include <cstddef>
+
+namespace clp
+{
+
+enum class BufferMode
+{
+    Copy = 0,     // Device-local buffer plus a host shadow
+    HostPtr = 1,  // CL_MEM_USE_HOST_PTR on page-aligned host storage
+    Svm = 2       // Coarse-grained SVM allocation (OpenCL 2.0)
+};
+
+const char* buffer_mode_name(BufferMode mode);
+
+// True when the device shares physical memory with the host
+bool unified_memory(const cl::Device& device);
+
+// Mode used for the runtime's device unless a HostBuffer is told otherwise
+BufferMode default_buffer_mode();
+
+template <typename T>
+class HostBuffer
+{
+  public:
+    // Uninitialised buffer of "count" elements; "access" is the kernels'
+    // 	view (CL_MEM_READ_ONLY, CL_MEM_WRITE_ONLY or CL_MEM_READ_WRITE)
+    explicit HostBuffer(std::size_t count,
+                        cl_mem_flags access = CL_MEM_READ_WRITE,
+                        BufferMode mode = default_buffer_mode());
+
+    // Same, initialised from "init" through the runtime's first queue
+    HostBuffer(const T* init,
+               std::size_t count,
+               cl_mem_flags access = CL_MEM_READ_WRITE,
+               BufferMode mode = default_buffer_mode());
+
+    // The buffer must be unmapped and no longer in use by the device
+    ~HostBuffer();
+
+    HostBuffer(const HostBuffer&) = delete;
+    HostBuffer& operator=(const HostBuffer&) = delete;
+
+    // Blocking: the returned pointer is valid until unmap(). Map with
+    // 	CL_MAP_WRITE_INVALIDATE_REGION when every element will be overwritten
+    T* map(cl::CommandQueue& queue, cl_map_flags flags = CL_MAP_READ | CL_MAP_WRITE);
+    void unmap(cl::CommandQueue& queue);
+
+    // For kernel arguments and the solver/operator interfaces
+    cl::Buffer& buffer() { return buffer_; }
+    const cl::Buffer& buffer() const { return buffer_; }
+
+    std::size_t size() const { return count_; }
+    BufferMode mode() const { return mode_; }
+    bool zero_copy() const { return mode_ != BufferMode::Copy; }
+
+  private:
+    std::size_t count_;
+    BufferMode mode_;
+    T* host_;  // Backing storage (HostPtr, Svm) or shadow (Copy)
+    cl::Buffer buffer_;
+    T* mapped_;
+    cl_map_flags mapped_flags_;
+};
+
+extern template class HostBuffer<int>;
+extern template class HostBuffer<float>;
+extern template class HostBuffer<double>;
+
+}  // namespace clp
+
+#endif  // CXX_CL_BUFFER_H
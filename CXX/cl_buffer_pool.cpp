@@ -0,0 +1,191 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Device Buffer Pool
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_buffer_pool.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace clp
+{
+namespace
+{
+
+// Smallest size class; tiny scalars and partials all share it
+const std::size_t kMinClass = 256;
+
+const cl_mem_flags kAccessFlags = CL_MEM_READ_WRITE | CL_MEM_READ_ONLY | CL_MEM_WRITE_ONLY;
+
+bool pool_enabled()
+{
+    const char* value = getenv("CLP_BUFFER_POOL");
+    return !(value && (std::string(value) == "0" || std::string(value) == "off"));
+}
+
+}  // namespace
+
+/************************************************************************
+ * Buffer Lease															*
+ ************************************************************************/
+
+BufferLease::BufferLease(BufferLease&& other) noexcept
+    : pool_(other.pool_),
+      buffer_(std::move(other.buffer_)),
+      context_(other.context_),
+      flags_(other.flags_),
+      size_(other.size_),
+      capacity_(other.capacity_)
+{
+    other.pool_ = nullptr;
+}
+
+BufferLease& BufferLease::operator=(BufferLease&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+        pool_ = other.pool_;
+        buffer_ = std::move(other.buffer_);
+        context_ = other.context_;
+        flags_ = other.flags_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.pool_ = nullptr;
+    }
+    return *this;
+}
+
+BufferLease::~BufferLease()
+{
+    release();
+}
+
+void BufferLease::release()
+{
+    if (pool_)
+    {
+        pool_->give_back(*this);
+        pool_ = nullptr;
+    }
+    buffer_ = cl::Buffer();
+}
+
+/************************************************************************
+ * Buffer Pool															*
+ ************************************************************************/
+
+BufferPool& BufferPool::instance()
+{
+    static BufferPool pool(pool_enabled());
+    return pool;
+}
+
+BufferPool::BufferPool(bool enabled) : enabled_(enabled) {}
+
+BufferPool::~BufferPool()
+{
+    trim();
+}
+
+std::size_t BufferPool::size_class(std::size_t bytes)
+{
+    std::size_t capacity = kMinClass;
+    while (capacity < bytes)
+    {
+        capacity *= 2;
+    }  // end while
+    return capacity;
+}
+
+BufferLease BufferPool::acquire(std::size_t bytes, cl_mem_flags flags, const cl::Context& context)
+{
+    if (flags & ~kAccessFlags)
+    {
+        throw std::invalid_argument("BufferPool: only access flags can be pooled, not host pointer flags");
+    }
+    if (flags == 0)
+    {
+        flags = CL_MEM_READ_WRITE;
+    }
+
+    // The lease only points back at the pool once it holds a buffer
+    BufferLease lease;
+    lease.context_ = context();
+    lease.flags_ = flags;
+    lease.size_ = bytes;
+    lease.capacity_ = size_class(bytes);
+
+    // [A]:Reuse a cached buffer of the same class
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.requests++;
+        auto it = free_.find(Key(lease.context_, flags, lease.capacity_));
+        if (it != free_.end() && !it->second.empty())
+        {
+            lease.buffer_ = std::move(it->second.back());
+            it->second.pop_back();
+            stats_.hits++;
+            stats_.live++;
+            stats_.live_bytes += lease.capacity_;
+            stats_.cached_bytes -= lease.capacity_;
+            lease.pool_ = this;
+            return lease;
+        }
+    }
+
+    // [B]:Otherwise create one, outside the lock
+    lease.buffer_ = cl::Buffer(context, flags, lease.capacity_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.allocations++;
+    stats_.live++;
+    stats_.live_bytes += lease.capacity_;
+    stats_.peak_bytes = std::max(stats_.peak_bytes, stats_.live_bytes + stats_.cached_bytes);
+    lease.pool_ = this;
+    return lease;
+}
+
+void BufferPool::give_back(BufferLease& lease)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.live--;
+    stats_.live_bytes -= lease.capacity_;
+    if (enabled_)
+    {
+        free_[Key(lease.context_, lease.flags_, lease.capacity_)].push_back(std::move(lease.buffer_));
+        stats_.cached_bytes += lease.capacity_;
+    }
+}
+
+void BufferPool::trim()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.clear();
+    stats_.cached_bytes = 0;
+}
+
+PoolStats BufferPool::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void BufferPool::print_stats() const
+{
+    const PoolStats s = stats();
+    printf("Buffer pool: %zu requests, hit rate %.1f%%, %zu created, peak %.2f MiB, %zu live (%.2f MiB)%s\n",
+           s.requests,
+           100.0 * s.hit_rate(),
+           s.allocations,
+           s.peak_bytes / 1048576.0,
+           s.live,
+           s.live_bytes / 1048576.0,
+           enabled_ ? "" : " [disabled]");
+}
+
+}  // namespace clp
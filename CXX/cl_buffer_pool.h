@@ -0,0 +1,133 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Device Buffer Pool
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Reuses device buffers instead of creating and releasing one per		*
+ * 	solve or per iteration. Requests are rounded up to a power-of-two	*
+ * 	size class and served from a free list kept per (context, memory	*
+ * 	flags, size class); a BufferLease hands its buffer back to that		*
+ * 	list when it goes out of scope. Buffers stay cached until trim().	*
+ *																		*
+ * 	CLP_BUFFER_POOL	 set to 0/off to create and release every buffer	*
+ * 					 (the unpooled baseline; stats are still kept)		*
+ ************************************************************************/
+
+#ifndef CXX_CL_BUFFER_POOL_H
+#define CXX_CL_BUFFER_POOL_H
+
+#include "cl_runtime.h"
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace clp
+{
+
+class BufferPool;
+
+struct PoolStats
+{
+    std::size_t requests = 0;
+    std::size_t hits = 0;          // Requests served from a free list
+    std::size_t allocations = 0;   // Buffers created
+    std::size_t live = 0;          // Leases currently held
+    std::size_t live_bytes = 0;    // Bytes behind those leases
+    std::size_t cached_bytes = 0;  // Bytes idle in the free lists
+    std::size_t peak_bytes = 0;    // High-water mark of live + cached bytes
+
+    double hit_rate() const { return requests ? static_cast<double>(hits) / requests : 0.0; }
+};
+
+/************************************************************************
+ * Buffer Lease															*
+ ************************************************************************/
+
+// Move-only handle on a pooled buffer; the buffer may be larger than the
+// 	size asked for. A buffer goes back to the pool as soon as its lease
+// 	ends, so only end a lease once every command using the buffer has
+// 	been enqueued on the (in-order) queue its next user will share
+class BufferLease
+{
+  public:
+    BufferLease() = default;
+    BufferLease(BufferLease&& other) noexcept;
+    BufferLease& operator=(BufferLease&& other) noexcept;
+    ~BufferLease();
+
+    BufferLease(const BufferLease&) = delete;
+    BufferLease& operator=(const BufferLease&) = delete;
+
+    cl::Buffer& buffer() { return buffer_; }
+    const cl::Buffer& buffer() const { return buffer_; }
+
+    std::size_t size() const { return size_; }          // Bytes requested
+    std::size_t capacity() const { return capacity_; }  // Bytes of the size class
+
+    // Returns the buffer to the pool early
+    void release();
+
+  private:
+    friend class BufferPool;
+
+    BufferPool* pool_ = nullptr;
+    cl::Buffer buffer_;
+    cl_context context_ = nullptr;
+    cl_mem_flags flags_ = 0;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+};
+
+/************************************************************************
+ * Buffer Pool															*
+ ************************************************************************/
+
+class BufferPool
+{
+  public:
+    // Process-wide pool configured from the environment
+    static BufferPool& instance();
+
+    explicit BufferPool(bool enabled = true);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // "flags" are the access flags only (CL_MEM_READ_WRITE, _READ_ONLY or
+    // 	_WRITE_ONLY); host pointer flags are rejected. The contents of a
+    // 	reused buffer are whatever its last user left
+    BufferLease acquire(std::size_t bytes,
+                        cl_mem_flags flags = CL_MEM_READ_WRITE,
+                        const cl::Context& context = Runtime::instance().context());
+
+    // Releases every cached (not leased) buffer
+    void trim();
+
+    PoolStats stats() const;
+    void print_stats() const;
+
+    bool enabled() const { return enabled_; }
+
+    // Power-of-two size class serving a request of "bytes"
+    static std::size_t size_class(std::size_t bytes);
+
+  private:
+    friend class BufferLease;
+
+    using Key = std::tuple<cl_context, cl_mem_flags, std::size_t>;
+
+    void give_back(BufferLease& lease);
+
+    bool enabled_;
+    mutable std::mutex mutex_;
+    std::map<Key, std::vector<cl::Buffer>> free_;
+    PoolStats stats_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_BUFFER_POOL_H
@@ -0,0 +1,212 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Conjugate Gradient Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* Vector kernels of the preconditioned conjugate gradient solver		*
+* 	(cl_cg_solver.h). The matrix only enters through y = A*x of the		*
+* 	DeviceOperator, everything else happens here. The scalars stay in	*
+* 	a small device buffer so an iteration never waits on the host:		*
+*																		*
+* 	scalars[RZ]    r.z of the current iterate							*
+* 	scalars[ALPHA] step length r.z / p.q								*
+* 	scalars[BETA]  direction update r.z(new) / r.z(old)					*
+* 	scalars[RR]    r.r, read back for the convergence test				*
+*																		*
+* 	Dot products reduce in two passes: one partial per power of two		*
+* 	work-group, then a single work-group folds the partials.			*
+************************************************************************/
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+#define RZ    0
+#define ALPHA 1
+#define BETA  2
+#define RR    3
+
+/************************************************************************
+* Work-Group Reduction Helpers 											*
+************************************************************************/
+// Tree reduces a and b over the work-group, leaving the sums in sa[0] and
+// 	sb[0]. Every work-item must call it.
+void reduce_pair(double a, double b, __local double *sa, __local double *sb){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	sa[lid] = a;
+	sb[lid] = b;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			sa[lid] += sa[lid+offset];
+			sb[lid] += sb[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+}
+
+// Strided sum of the first ngroups partials over ONE work-group
+void fold_pair(int ngroups, const __global double *pa, const __global double *pb,
+				__local double *sa, __local double *sb){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	int i;
+	double a = 0;
+	double b = 0;
+	for (i = lid; i < ngroups; i += lsize){
+		a += pa[i];
+		b += pb[i];
+	}/*end i*/
+
+	reduce_pair(a, b, sa, sb);
+}
+
+
+/************************************************************************
+* Jacobi Preconditioner Kernels 										*
+************************************************************************/
+
+// d = 1/d in place; *missing drops to the first row whose diagonal entry
+// is zero, which the host then reports
+__kernel void cl_invert(int n, __global double *d, __global int *missing){
+	int gid = get_global_id(0);
+	if (gid < n){
+		if (d[gid] != 0){
+			d[gid] = 1.0/d[gid];
+		}
+		else{
+			atomic_min(missing, gid);
+		}/*end if*/
+	}/*end if*/
+}
+
+// z = dinv*r
+__kernel void cl_diag_scale(int n, const __global double *dinv, const __global double *r,
+							__global double *z){
+	int gid = get_global_id(0);
+	if (gid < n){
+		z[gid] = dinv[gid]*r[gid];
+	}/*end if*/
+}
+
+
+/************************************************************************
+* Setup Kernels 														*
+************************************************************************/
+
+// r = b - Ax, z = dinv*r and partial r.z, r.r (Ax is passed in as q)
+__kernel void cl_cg_residual(int n, const __global double *b, const __global double *q,
+							const __global double *dinv, __global double *r,
+							__global double *z, __global double *partial_rz,
+							__global double *partial_rr, __local double *srz,
+							__local double *srr){
+	int gid = get_global_id(0);
+
+	double rz = 0;
+	double rr = 0;
+	if (gid < n){
+		double ri = b[gid] - q[gid];
+		double zi = dinv[gid]*ri;
+		r[gid] = ri;
+		z[gid] = zi;
+		rz = ri*zi;
+		rr = ri*ri;
+	}/*end if*/
+
+	reduce_pair(rz, rr, srz, srr);
+	if (get_local_id(0) == 0){
+		partial_rz[get_group_id(0)] = srz[0];
+		partial_rr[get_group_id(0)] = srr[0];
+	}/*end if*/
+}
+
+
+/************************************************************************
+* Iteration Kernels 													*
+************************************************************************/
+
+// One partial x.y per work-group
+__kernel void cl_dot_partial(int n, const __global double *x, const __global double *y,
+							__global double *partial, __local double *sa,
+							__local double *sb){
+	int gid = get_global_id(0);
+
+	double xy = 0;
+	if (gid < n){
+		xy = x[gid]*y[gid];
+	}/*end if*/
+
+	reduce_pair(xy, 0, sa, sb);
+	if (get_local_id(0) == 0){
+		partial[get_group_id(0)] = sa[0];
+	}/*end if*/
+}
+
+// alpha = r.z / p.q from the partials of p.q
+__kernel void cl_cg_alpha(int ngroups, const __global double *partial_pq,
+							__global double *scalars, __local double *sa,
+							__local double *sb){
+	fold_pair(ngroups, partial_pq, partial_pq, sa, sb);
+	if (get_local_id(0) == 0){
+		double pq = sa[0];
+		scalars[ALPHA] = pq != 0 ? scalars[RZ]/pq : 0;
+	}/*end if*/
+}
+
+// Fused: x += alpha*p, r -= alpha*q, z = dinv*r, and partial r.z, r.r in
+// 	the same pass over the vectors
+__kernel void cl_cg_update(int n, const __global double *scalars, const __global double *p,
+							const __global double *q, const __global double *dinv,
+							__global double *x, __global double *r, __global double *z,
+							__global double *partial_rz, __global double *partial_rr,
+							__local double *srz, __local double *srr){
+	int gid = get_global_id(0);
+	double alpha = scalars[ALPHA];
+
+	double rz = 0;
+	double rr = 0;
+	if (gid < n){
+		double ri = r[gid] - alpha*q[gid];
+		double zi = dinv[gid]*ri;
+		x[gid] += alpha*p[gid];
+		r[gid]  = ri;
+		z[gid]  = zi;
+		rz = ri*zi;
+		rr = ri*ri;
+	}/*end if*/
+
+	reduce_pair(rz, rr, srz, srr);
+	if (get_local_id(0) == 0){
+		partial_rz[get_group_id(0)] = srz[0];
+		partial_rr[get_group_id(0)] = srr[0];
+	}/*end if*/
+}
+
+// beta = r.z(new) / r.z(old), then r.z and r.r move to the new iterate.
+// 	beta is 0 on the first call (r.z(old) = 0), which makes p = z
+__kernel void cl_cg_beta(int ngroups, const __global double *partial_rz,
+							const __global double *partial_rr, __global double *scalars,
+							__local double *sa, __local double *sb){
+	fold_pair(ngroups, partial_rz, partial_rr, sa, sb);
+	if (get_local_id(0) == 0){
+		double rz_old = scalars[RZ];
+		scalars[BETA] = rz_old != 0 ? sa[0]/rz_old : 0;
+		scalars[RZ]   = sa[0];
+		scalars[RR]   = sb[0];
+	}/*end if*/
+}
+
+// p = z + beta*p
+__kernel void cl_cg_direction(int n, const __global double *scalars, const __global double *z,
+							__global double *p){
+	int gid = get_global_id(0);
+	if (gid < n){
+		p[gid] = z[gid] + scalars[BETA]*p[gid];
+	}/*end if*/
+}
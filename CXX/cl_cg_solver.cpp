@@ -0,0 +1,282 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Conjugate Gradient Solver
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_cg_solver.h"
+#include "cl_buffer_pool.h"
+#include "cl_profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <stdio.h>
+
+namespace clp
+{
+namespace
+{
+
+// Slot of r.r in the device scalars (see cl_cg.cl)
+const int kScalarRR = 3;
+const int kScalarCount = 4;
+
+cl::Program cg_program()
+{
+    return build_program(load_kernel_source("cl_cg.cl"));
+}
+
+std::size_t work_items(int n, std::size_t local)
+{
+    return (n + local - 1) / local * local;
+}
+
+}  // namespace
+
+/************************************************************************
+ * Jacobi Preconditioner												*
+ ************************************************************************/
+
+JacobiPreconditioner::JacobiPreconditioner(cl::CommandQueue& queue, DeviceOperator& A) : rows_(A.rows())
+{
+    if (A.scalar_size() != sizeof(double))
+    {
+        throw std::invalid_argument("JacobiPreconditioner: needs a double precision operator");
+    }
+    cl::Program program = cg_program();
+    cl::Kernel invert(program, "cl_invert");
+    scale_ = cl::Kernel(program, "cl_diag_scale");
+
+    dinv_ = cl::Buffer(Runtime::instance().context(), CL_MEM_READ_WRITE, sizeof(double) * rows_);
+    A.diagonal(queue, dinv_);
+
+    // [A]:Invert in place, flagging the first zero diagonal entry; M^-1
+    // 	does not exist then, so the setup fails rather than guess one
+    int missing = rows_;
+    cl::Buffer flag(Runtime::instance().context(), CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(int), &missing);
+    invert.setArg(0, rows_);
+    invert.setArg(1, dinv_);
+    invert.setArg(2, flag);
+    queue.enqueueNDRangeKernel(
+        invert, cl::NullRange, cl::NDRange(rows_), cl::NullRange, nullptr, CLP_TRACE("cl_invert", nullptr));
+    queue.enqueueReadBuffer(
+        flag, CL_TRUE, 0, sizeof(int), &missing, nullptr, CLP_TRACE("read diagonal check", nullptr));
+    if (missing < rows_)
+    {
+        throw std::invalid_argument("JacobiPreconditioner: no non-zero diagonal entry in row " +
+                                    std::to_string(missing));
+    }
+
+    scale_.setArg(0, rows_);
+    scale_.setArg(1, dinv_);
+}
+
+void JacobiPreconditioner::apply(cl::CommandQueue& queue, const cl::Buffer& r, cl::Buffer& z)
+{
+    scale_.setArg(2, r);
+    scale_.setArg(3, z);
+    queue.enqueueNDRangeKernel(
+        scale_, cl::NullRange, cl::NDRange(rows_), cl::NullRange, nullptr, CLP_TRACE("cl_diag_scale", nullptr));
+}
+
+/************************************************************************
+ * Solver																*
+ ************************************************************************/
+
+CgSolver::CgSolver(CgOptions options) : options_(options)
+{
+    options_.check_every = std::max(1, options_.check_every);
+
+    cl::Program program = cg_program();
+    residual_ = cl::Kernel(program, "cl_cg_residual");
+    dot_ = cl::Kernel(program, "cl_dot_partial");
+    alpha_ = cl::Kernel(program, "cl_cg_alpha");
+    update_ = cl::Kernel(program, "cl_cg_update");
+    beta_ = cl::Kernel(program, "cl_cg_beta");
+    direction_ = cl::Kernel(program, "cl_cg_direction");
+
+    // One power of two local size for every reducing kernel
+    const cl::Device& device = Runtime::instance().device();
+    std::size_t limit = 256;
+    for (const cl::Kernel* kernel : {&residual_, &dot_, &alpha_, &update_, &beta_})
+    {
+        limit = std::min(limit, kernel->getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device));
+    }  // end kernel
+    local_ = 1;
+    while (local_ * 2 <= limit)
+    {
+        local_ *= 2;
+    }  // end while
+}
+
+SolveResult CgSolver::solve(cl::CommandQueue& queue,
+                            DeviceOperator& A,
+                            const cl::Buffer& b,
+                            cl::Buffer& x,
+                            Preconditioner* M)
+{
+    if (A.scalar_size() != sizeof(double))
+    {
+        throw std::invalid_argument("CgSolver: needs a double precision operator");
+    }
+    const int n = A.rows();
+    const int groups = static_cast<int>((n + local_ - 1) / local_);
+    const cl::NDRange global(work_items(n, local_));
+    const cl::NDRange local(local_);
+    const cl::LocalSpaceArg scratch = cl::Local(sizeof(double) * local_);
+    SolveResult result;
+
+    // [A]:Work vectors, partials and scalars, leased from the buffer pool
+    BufferPool& pool = BufferPool::instance();
+    BufferLease r_lease = pool.acquire(sizeof(double) * n);
+    BufferLease z_lease = pool.acquire(sizeof(double) * n);
+    BufferLease p_lease = pool.acquire(sizeof(double) * n);
+    BufferLease q_lease = pool.acquire(sizeof(double) * n);
+    BufferLease partial_a_lease = pool.acquire(sizeof(double) * groups);
+    BufferLease partial_b_lease = pool.acquire(sizeof(double) * groups);
+    BufferLease scalars_lease = pool.acquire(sizeof(double) * kScalarCount);
+    cl::Buffer& r = r_lease.buffer();
+    cl::Buffer& z = z_lease.buffer();
+    cl::Buffer& p = p_lease.buffer();
+    cl::Buffer& q = q_lease.buffer();
+    cl::Buffer& partial_a = partial_a_lease.buffer();
+    cl::Buffer& partial_b = partial_b_lease.buffer();
+    cl::Buffer& scalars = scalars_lease.buffer();
+    queue.enqueueFillBuffer(scalars, 0.0, 0, sizeof(double) * kScalarCount);
+    queue.enqueueFillBuffer(p, 0.0, 0, sizeof(double) * n);
+
+    // A diagonal M is folded into the fused kernels; otherwise they see
+    // 	M = I and the real M is applied after them
+    const bool fused = M == nullptr || M->inverse_diagonal() != nullptr;
+    BufferLease ones_lease;
+    cl::Buffer& ones = ones_lease.buffer();
+    if (!fused || M == nullptr)
+    {
+        ones_lease = pool.acquire(sizeof(double) * n, CL_MEM_READ_ONLY);
+        queue.enqueueFillBuffer(ones, 1.0, 0, sizeof(double) * n);
+    }
+    const cl::Buffer& dinv = (M != nullptr && fused) ? *M->inverse_diagonal() : ones;
+
+    // [B]:Bind everything that does not change between iterations
+    residual_.setArg(0, n);
+    residual_.setArg(1, b);
+    residual_.setArg(2, q);
+    residual_.setArg(3, dinv);
+    residual_.setArg(4, r);
+    residual_.setArg(5, z);
+    residual_.setArg(6, partial_a);
+    residual_.setArg(7, partial_b);
+    residual_.setArg(8, scratch);
+    residual_.setArg(9, scratch);
+
+    dot_.setArg(0, n);
+    dot_.setArg(3, partial_a);
+    dot_.setArg(4, scratch);
+    dot_.setArg(5, scratch);
+
+    alpha_.setArg(0, groups);
+    alpha_.setArg(1, partial_a);
+    alpha_.setArg(2, scalars);
+    alpha_.setArg(3, scratch);
+    alpha_.setArg(4, scratch);
+
+    update_.setArg(0, n);
+    update_.setArg(1, scalars);
+    update_.setArg(2, p);
+    update_.setArg(3, q);
+    update_.setArg(4, dinv);
+    update_.setArg(5, x);
+    update_.setArg(6, r);
+    update_.setArg(7, z);
+    update_.setArg(8, partial_a);
+    update_.setArg(9, partial_b);
+    update_.setArg(10, scratch);
+    update_.setArg(11, scratch);
+
+    beta_.setArg(0, groups);
+    beta_.setArg(1, partial_a);
+    beta_.setArg(2, partial_b);
+    beta_.setArg(3, scalars);
+    beta_.setArg(4, scratch);
+    beta_.setArg(5, scratch);
+
+    direction_.setArg(0, n);
+    direction_.setArg(1, scalars);
+    direction_.setArg(2, z);
+    direction_.setArg(3, p);
+
+    // z = M^-1 r and partial_a = r.z for a non-diagonal M
+    auto precondition = [&]() {
+        M->apply(queue, r, z);
+        dot_.setArg(1, r);
+        dot_.setArg(2, z);
+        queue.enqueueNDRangeKernel(dot_, cl::NullRange, global, local, nullptr, CLP_TRACE("cl_dot_partial", nullptr));
+    };
+
+    // ||r||_2 from the scalars; the only host synchronisation
+    auto read_residual = [&]() {
+        double rr;
+        queue.enqueueReadBuffer(
+            scalars, CL_TRUE, sizeof(double) * kScalarRR, sizeof(double), &rr, nullptr, CLP_TRACE("read rr", nullptr));
+        return std::sqrt(std::max(rr, 0.0));
+    };
+
+    // [C]:r = b - Ax, z = M^-1 r, p = z (beta is 0 on the first pass)
+    A.apply(queue, x, q);
+    queue.enqueueNDRangeKernel(residual_, cl::NullRange, global, local, nullptr, CLP_TRACE("cl_cg_residual", nullptr));
+    if (!fused)
+    {
+        precondition();
+    }
+    queue.enqueueNDRangeKernel(beta_, cl::NullRange, local, local, nullptr, CLP_TRACE("cl_cg_beta", nullptr));
+    queue.enqueueNDRangeKernel(
+        direction_, cl::NullRange, global, local, nullptr, CLP_TRACE("cl_cg_direction", nullptr));
+
+    int iter = 0;
+    double res = read_residual();
+    if (options_.verbose)
+    {
+        printf("iter = %d | L2 Residual = %f\n", iter, res);
+    }
+
+    while (res > options_.tol && iter < options_.maxiter)
+    {
+        iter += 1;
+
+        // [D]:q = Ap, alpha = r.z / p.q
+        A.apply(queue, p, q);
+        dot_.setArg(1, p);
+        dot_.setArg(2, q);
+        queue.enqueueNDRangeKernel(dot_, cl::NullRange, global, local, nullptr, CLP_TRACE("cl_dot_partial", nullptr));
+        queue.enqueueNDRangeKernel(alpha_, cl::NullRange, local, local, nullptr, CLP_TRACE("cl_cg_alpha", nullptr));
+
+        // [E]:Fused x, r, z update with the r.z, r.r partials
+        queue.enqueueNDRangeKernel(update_, cl::NullRange, global, local, nullptr, CLP_TRACE("cl_cg_update", nullptr));
+        if (!fused)
+        {
+            precondition();
+        }
+
+        // [F]:beta and the new search direction
+        queue.enqueueNDRangeKernel(beta_, cl::NullRange, local, local, nullptr, CLP_TRACE("cl_cg_beta", nullptr));
+        queue.enqueueNDRangeKernel(
+        direction_, cl::NullRange, global, local, nullptr, CLP_TRACE("cl_cg_direction", nullptr));
+
+        // [G]:Only a scalar crosses back to the host, every N iterations
+        if (iter % options_.check_every == 0 || iter == options_.maxiter)
+        {
+            res = read_residual();
+            if (options_.verbose)
+            {
+                printf("iter = %d | L2 Residual = %f\n", iter, res);
+            }
+        }  // end if
+    }  // end while
+
+    result.iterations = iter;
+    result.residual = res;
+    result.converged = res <= options_.tol;
+    return result;
+}
+
+}  // namespace clp
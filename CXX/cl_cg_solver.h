@@ -0,0 +1,100 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Conjugate Gradient Solver
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Preconditioned conjugate gradient for symmetric positive definite	*
+ * 	systems on any DeviceOperator (see cl_operator.h). All vectors and	*
+ * 	the CG scalars stay on the device (cl_cg.cl); the update of x, r	*
+ * 	and z and the dot products r.z, r.r share one fused pass, and only	*
+ * 	||r||_2 is read back, every check_every iterations.					*
+ *																		*
+ * 	A diagonal preconditioner (JacobiPreconditioner, or none) is folded	*
+ * 	into the fused kernels; any other Preconditioner costs one extra	*
+ * 	apply and dot product per iteration.									*
+ *																		*
+ * 	cl_cg.cl works in double: the operator must be a <double> one.		*
+ ************************************************************************/
+
+#ifndef CXX_CL_CG_SOLVER_H
+#define CXX_CL_CG_SOLVER_H
+
+#include "cl_operator.h"
+
+namespace clp
+{
+
+/************************************************************************
+ * Preconditioners														*
+ ************************************************************************/
+
+class Preconditioner
+{
+  public:
+    virtual ~Preconditioner() = default;
+
+    // z = M^-1 r
+    virtual void apply(cl::CommandQueue& queue, const cl::Buffer& r, cl::Buffer& z) = 0;
+
+    // M^-1 as a vector when M is diagonal, nullptr otherwise
+    virtual const cl::Buffer* inverse_diagonal() const { return nullptr; }
+};
+
+// M = diag(A). Throws std::invalid_argument when a diagonal entry of A is
+// 	zero, as require_diagonal does for the host matrices
+class JacobiPreconditioner : public Preconditioner
+{
+  public:
+    JacobiPreconditioner(cl::CommandQueue& queue, DeviceOperator& A);
+
+    void apply(cl::CommandQueue& queue, const cl::Buffer& r, cl::Buffer& z) override;
+    const cl::Buffer* inverse_diagonal() const override { return &dinv_; }
+
+  private:
+    int rows_;
+    cl::Kernel scale_;
+    cl::Buffer dinv_;
+};
+
+/************************************************************************
+ * Solver																*
+ ************************************************************************/
+
+struct CgOptions
+{
+    double tol = 0.001;    // On ||r||_2 of the CG recurrence
+    int maxiter = 1000;
+    int check_every = 10;  // Residual read back interval (iterations)
+    bool verbose = true;   // Print every residual that is read back
+};
+
+class CgSolver
+{
+  public:
+    explicit CgSolver(CgOptions options = CgOptions());
+
+    // Solves A x = b; x holds the initial guess and receives the solution.
+    // 	M may be nullptr (plain CG). The queue must be in-order
+    SolveResult solve(cl::CommandQueue& queue,
+                      DeviceOperator& A,
+                      const cl::Buffer& b,
+                      cl::Buffer& x,
+                      Preconditioner* M = nullptr);
+
+    const CgOptions& options() const { return options_; }
+
+  private:
+    CgOptions options_;
+    cl::Kernel residual_;
+    cl::Kernel dot_;
+    cl::Kernel alpha_;
+    cl::Kernel update_;
+    cl::Kernel beta_;
+    cl::Kernel direction_;
+    std::size_t local_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_CG_SOLVER_H
@@ -0,0 +1,96 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Tiled Matrix Multiplication Kernel
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* General matrix-matrix multiply C = alpha*A*B + beta*C with row-major	*
+* 	A (M x K), B (K x N) and C (M x N). Each operand starts at an element	*
+* 	offset into its buffer and has its own leading dimension (row		*
+* 	stride), so sub-blocks of a larger matrix can be multiplied in		*
+* 	place. Compile-time parameters, passed as build options:			*
+*																		*
+* 	REAL  scalar type, float or double (default double)					*
+* 	TS    square tile edge held in local memory (default 16)			*
+* 	WPT   rows of C computed per work-item, i.e. the register block		*
+* 		  (default 4, must divide TS)									*
+*																		*
+* 	Launch with local size (TS, TS/WPT) and global size					*
+* 	(ceil(N/TS)*TS, ceil(M/TS)*TS/WPT). Tiles that hang over the edge	*
+* 	of A or B are zero padded, so M, N and K are arbitrary.				*
+************************************************************************/
+
+#ifndef REAL
+#define REAL double
+#endif
+
+#ifndef TS
+#define TS 16
+#endif
+
+#ifndef WPT
+#define WPT 4
+#endif
+
+#define RTS (TS/WPT)
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+__kernel void cl_gemm(int M, int N, int K, REAL alpha, const __global REAL *A, int offA,
+						int lda, const __global REAL *B, int offB, int ldb, REAL beta,
+						__global REAL *C, int offC, int ldc){
+	//[A]:Get Local and Global IDs
+	const int lc   = get_local_id(0);				// column inside the tile
+	const int lr   = get_local_id(1);				// row group inside the tile
+	const int col  = get_group_id(0)*TS + lc;		// column of C
+	const int row0 = get_group_id(1)*TS + lr;		// first row of C
+
+	__local REAL Asub[TS][TS];
+	__local REAL Bsub[TS][TS];
+
+	//[B]:Register block of WPT accumulators
+	REAL acc[WPT];
+	int w;
+	for (w = 0; w < WPT; w++){
+		acc[w] = 0;
+	}/*end w*/
+
+	//[C]:Loop over the tiles of the K dimension
+	const int ntiles = (K + TS - 1)/TS;
+	int t,k;
+	for (t = 0; t < ntiles; t++){
+
+		// Cooperative zero padded load of one tile of A and one of B
+		for (w = 0; w < WPT; w++){
+			const int r    = lr + w*RTS;
+			const int arow = get_group_id(1)*TS + r;
+			const int acol = t*TS + lc;
+			const int brow = t*TS + r;
+			Asub[r][lc] = (arow < M && acol < K) ? A[offA + acol + lda*arow] : 0;
+			Bsub[r][lc] = (brow < K && col < N) ? B[offB + col + ldb*brow] : 0;
+		}/*end w*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		// Each B value is read once from local memory and reused WPT times
+		for (k = 0; k < TS; k++){
+			const REAL bk = Bsub[k][lc];
+			for (w = 0; w < WPT; w++){
+				acc[w] += Asub[lr + w*RTS][k]*bk;
+			}/*end w*/
+		}/*end k*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+	}/*end t*/
+
+	//[D]:Write back, skipping the padding
+	for (w = 0; w < WPT; w++){
+		const int row = row0 + w*RTS;
+		if (row < M && col < N){
+			// beta == 0 must not read C, which may hold garbage/NaN
+			const int c = offC + col + ldc*row;
+			C[c] = (beta == 0) ? alpha*acc[w] : alpha*acc[w] + beta*C[c];
+		}/*end if*/
+	}/*end w*/
+}
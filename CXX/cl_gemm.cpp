@@ -0,0 +1,159 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Tiled Matrix Multiplication
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_gemm.h"
+#include "cl_autotune.h"
+#include "cl_profiler.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace clp
+{
+
+template <typename Real>
+Gemm<Real>::Gemm(GemmConfig config) : config_(config)
+{
+    if (config_.tile <= 0 || config_.wpt <= 0 || config_.tile % config_.wpt != 0)
+    {
+        throw std::invalid_argument("Gemm: wpt must be a positive divisor of tile");
+    }
+
+    const std::string options = std::string("-cl-std=CL2.0 -DREAL=") + cl_type_name<Real>() +
+                                " -DTS=" + std::to_string(config_.tile) + " -DWPT=" + std::to_string(config_.wpt);
+    program_ = build_program(load_kernel_source("cl_gemm.cl"), options);
+    kernel_ = cl::Kernel(program_, "cl_gemm");
+
+    const std::size_t group = static_cast<std::size_t>(config_.tile) * (config_.tile / config_.wpt);
+    if (group > kernel_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(Runtime::instance().device()))
+    {
+        throw std::invalid_argument("Gemm: tile*tile/wpt exceeds the kernel work-group size limit");
+    }
+}
+
+template <typename Real>
+void Gemm<Real>::operator()(cl::CommandQueue& queue,
+                            int M,
+                            int N,
+                            int K,
+                            Real alpha,
+                            const cl::Buffer& A,
+                            const cl::Buffer& B,
+                            Real beta,
+                            cl::Buffer& C,
+                            const std::vector<cl::Event>* wait,
+                            cl::Event* event)
+{
+    (*this)(queue, M, N, K, alpha, A, 0, K, B, 0, N, beta, C, 0, N, wait, event);
+}
+
+template <typename Real>
+void Gemm<Real>::operator()(cl::CommandQueue& queue,
+                            int M,
+                            int N,
+                            int K,
+                            Real alpha,
+                            const cl::Buffer& A,
+                            int offA,
+                            int lda,
+                            const cl::Buffer& B,
+                            int offB,
+                            int ldb,
+                            Real beta,
+                            cl::Buffer& C,
+                            int offC,
+                            int ldc,
+                            const std::vector<cl::Event>* wait,
+                            cl::Event* event)
+{
+    const int ts = config_.tile;
+    const int rts = config_.tile / config_.wpt;
+
+    kernel_.setArg(0, M);
+    kernel_.setArg(1, N);
+    kernel_.setArg(2, K);
+    kernel_.setArg(3, alpha);
+    kernel_.setArg(4, A);
+    kernel_.setArg(5, offA);
+    kernel_.setArg(6, lda);
+    kernel_.setArg(7, B);
+    kernel_.setArg(8, offB);
+    kernel_.setArg(9, ldb);
+    kernel_.setArg(10, beta);
+    kernel_.setArg(11, C);
+    kernel_.setArg(12, offC);
+    kernel_.setArg(13, ldc);
+
+    // Round the grid up to whole tiles; the kernel zero pads the overhang
+    cl::NDRange global((N + ts - 1) / ts * ts, (M + ts - 1) / ts * rts);
+    cl::NDRange local(ts, rts);
+    queue.enqueueNDRangeKernel(kernel_, cl::NullRange, global, local, wait, CLP_TRACE("cl_gemm", event));
+}
+
+template class Gemm<float>;
+template class Gemm<double>;
+
+/************************************************************************
+ * Tuned Configuration													*
+ ************************************************************************/
+
+template <typename Real>
+GemmConfig tuned_gemm_config(int M, int N, int K)
+{
+    // [A]:Search space, default configuration first
+    std::vector<TuneParams> candidates = {{{"tile", 16}, {"wpt", 4}}};
+    for (int tile : {8, 16, 32})
+    {
+        for (int wpt : {1, 2, 4, 8})
+        {
+            if (wpt <= tile && !(tile == 16 && wpt == 4))
+            {
+                candidates.push_back({{"tile", tile}, {"wpt", wpt}});
+            }
+        }  // end wpt
+    }  // end tile
+
+    // [B]:Scratch operands, only touched on a tuning miss
+    const cl::Context& context = Runtime::instance().context();
+    std::unique_ptr<cl::Buffer> A, B, C;
+    std::map<std::pair<int, int>, std::unique_ptr<Gemm<Real>>> kernels;
+
+    auto launch = [&](cl::CommandQueue& queue, const TuneParams& params) {
+        if (!A)
+        {
+            A.reset(new cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(Real) * M * K));
+            B.reset(new cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(Real) * K * N));
+            C.reset(new cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(Real) * M * N));
+            queue.enqueueFillBuffer(*A, Real(1), 0, sizeof(Real) * M * K);
+            queue.enqueueFillBuffer(*B, Real(1), 0, sizeof(Real) * K * N);
+        }
+        GemmConfig config;
+        config.tile = params.at("tile");
+        config.wpt = params.at("wpt");
+        auto& gemm = kernels[{config.tile, config.wpt}];
+        if (!gemm)
+        {
+            gemm.reset(new Gemm<Real>(config));
+        }
+        cl::Event event;
+        (*gemm)(queue, M, N, K, Real(1), *A, *B, Real(0), *C, nullptr, &event);
+        return event;
+    };
+
+    const std::string name = std::string("cl_gemm<") + cl_type_name<Real>() + ">";
+    TuneParams best = AutoTuner::instance().tune(name, std::max({M, N, K}), candidates, launch);
+
+    GemmConfig config;
+    config.tile = best.at("tile");
+    config.wpt = best.at("wpt");
+    return config;
+}
+
+template GemmConfig tuned_gemm_config<float>(int, int, int);
+template GemmConfig tuned_gemm_config<double>(int, int, int);
+
+}  // namespace clp
@@ -0,0 +1,89 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Tiled Matrix Multiplication
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Host side of cl_gemm.cl: C = alpha*A*B + beta*C on row-major device	*
+ * 	buffers, with local-memory tiling and register blocking. Gemm<float>	*
+ * 	is SGEMM, Gemm<double> is DGEMM.									*
+ ************************************************************************/
+
+#ifndef CXX_CL_GEMM_H
+#define CXX_CL_GEMM_H
+
+#include "cl_runtime.h"
+#include <vector>
+
+namespace clp
+{
+
+struct GemmConfig
+{
+    int tile = 16;  // TS: tile edge held in local memory
+    int wpt = 4;    // WPT: rows of C per work-item, must divide tile
+};
+
+template <typename Real>
+class Gemm
+{
+  public:
+    // Builds cl_gemm.cl for the runtime's device with the given tiling.
+    // 	Throws std::invalid_argument for a tiling the device cannot launch
+    explicit Gemm(GemmConfig config = GemmConfig());
+
+    // C (M x N) = alpha * A (M x K) * B (K x N) + beta * C
+    void operator()(cl::CommandQueue& queue,
+                    int M,
+                    int N,
+                    int K,
+                    Real alpha,
+                    const cl::Buffer& A,
+                    const cl::Buffer& B,
+                    Real beta,
+                    cl::Buffer& C,
+                    const std::vector<cl::Event>* wait = nullptr,
+                    cl::Event* event = nullptr);
+
+    // Same on sub-blocks: each operand starts at an element offset into its
+    // 	buffer and has its own leading dimension (row stride)
+    void operator()(cl::CommandQueue& queue,
+                    int M,
+                    int N,
+                    int K,
+                    Real alpha,
+                    const cl::Buffer& A,
+                    int offA,
+                    int lda,
+                    const cl::Buffer& B,
+                    int offB,
+                    int ldb,
+                    Real beta,
+                    cl::Buffer& C,
+                    int offC,
+                    int ldc,
+                    const std::vector<cl::Event>* wait = nullptr,
+                    cl::Event* event = nullptr);
+
+    const GemmConfig& config() const { return config_; }
+
+  private:
+    GemmConfig config_;
+    cl::Program program_;
+    cl::Kernel kernel_;
+};
+
+extern template class Gemm<float>;
+extern template class Gemm<double>;
+
+// Tile/register-block configuration picked by the auto-tuner for this
+// 	problem size on the runtime's device (see cl_autotune.h)
+template <typename Real>
+GemmConfig tuned_gemm_config(int M, int N, int K);
+
+using Sgemm = Gemm<float>;
+using Dgemm = Gemm<double>;
+
+}  // namespace clp
+
+#endif  // CXX_CL_GEMM_H
@@ -1,14 +1,28 @@
-__kernel void cl_jacobi(int ny, const __global double *A, const __global double *b,
-								const __global double *xn, __global double *x){
+// Scalar type, float or double (default double), set with -DREAL=...
+#ifndef REAL
+#define REAL double
+#endif
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+__kernel void cl_jacobi(int ny, const __global REAL *A, const __global REAL *b,
+								const __global REAL *xn, __global REAL *x){
 	//[A]:Get Global ID
 	int gid  = get_global_id(0);
 	//printf("gid = %d\n",gid);
 
+	// The global size is rounded up to a multiple of the (tuned) local size
+	if (gid >= ny){
+		return;
+	}/*end if*/
+
 	//[B]:Calculate sum
 	int k;
 	int j = gid;
 
-	double sum = 0;
+	REAL sum = 0;
 	for (k = 0; k < ny; k++){
 		if (k != gid){
 			//printf("xn[%d] = %f\n",k,xn[k]);
@@ -22,3 +36,208 @@ __kernel void cl_jacobi(int ny, const __global double *A, const __global double
 	x[gid] = (b[gid] - sum)/A[gid+ny*gid];
 	//printf("x[%d] = %f\n",gid,x);
 }
+
+
+
+/************************************************************************
+* Coloured Gauss-Seidel / SOR Sweep 										*
+************************************************************************/
+// In-place pass over the "count" rows rows[first ..] of one colour. Rows of
+// 	a colour never reference each other, so each sees the latest values of
+// 	every other colour: omega = 1 is Gauss-Seidel, 1 < omega < 2 is SOR.
+__kernel void cl_sor(int ny, const __global REAL *A, const __global REAL *b, __global REAL *x,
+								const __global int *rows, int first, int count, REAL omega){
+	int k = get_global_id(0);
+	if (k >= count){
+		return;
+	}/*end if*/
+
+	int row = rows[first + k];
+	int j;
+	REAL sum = 0;
+	for (j = 0; j < ny; j++){
+		if (j != row){
+			sum += A[j+ny*row]*x[j];
+		}/*end if*/
+	}/*end j*/
+	x[row] += omega*((b[row] - sum)/A[row+ny*row] - x[row]);
+}
+
+
+
+/************************************************************************
+* Dense Matrix-Vector Product and Diagonal 								*
+************************************************************************/
+// y = A*x for a row-major ny x ny matrix, one work-item per row
+__kernel void cl_matvec(int ny, const __global REAL *A, const __global REAL *x,
+								__global REAL *y){
+	int gid = get_global_id(0);
+	if (gid >= ny){
+		return;
+	}/*end if*/
+
+	int k;
+	REAL sum = 0;
+	for (k = 0; k < ny; k++){
+		sum += A[k+ny*gid]*x[k];
+	}/*end k*/
+	y[gid] = sum;
+}
+
+
+
+// d = diag(A)
+__kernel void cl_diagonal(int ny, const __global REAL *A, __global REAL *d){
+	int gid = get_global_id(0);
+	if (gid < ny){
+		d[gid] = A[gid+ny*gid];
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Residual Norm Kernels: Pass 1 										*
+************************************************************************/
+// One work-item per row computes r_i = b_i - (Ax)_i. Each work-group then
+// 	tree reduces max|r_i| and sum r_i^2 in local memory and writes one
+// 	partial per group. The local size must be a power of two; the global
+// 	size is ny rounded up to a multiple of it.
+__kernel void cl_residual_partial(int ny, const __global REAL *A, const __global REAL *b,
+								const __global REAL *x, __global REAL *partial_max,
+								__global REAL *partial_sq, __local REAL *smax,
+								__local REAL *ssq){
+	//[A]:Get Global and Local IDs
+	int gid   = get_global_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	//[B]:Row residual (padding work-items contribute zero)
+	int k;
+	REAL r = 0;
+	if (gid < ny){
+		REAL sum = 0;
+		for (k = 0; k < ny; k++){
+			sum += A[k+ny*gid]*x[k];
+		}/*end k*/
+		r = b[gid] - sum;
+	}/*end if*/
+
+	smax[lid] = fabs(r);
+	ssq[lid]  = r*r;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[C]:Tree reduction in local memory
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			smax[lid] = fmax(smax[lid], smax[lid+offset]);
+			ssq[lid] += ssq[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+
+	//[D]:One partial per work-group
+	if (lid == 0){
+		partial_max[get_group_id(0)] = smax[0];
+		partial_sq[get_group_id(0)]  = ssq[0];
+	}/*end if*/
+}
+
+
+/************************************************************************
+* Residual Norm Kernels: Pass 2 										*
+************************************************************************/
+// Folds the per-group partials of cl_residual_partial into
+// 	norms[0] = ||b - Ax||_inf and norms[1] = ||b - Ax||_2. Launch as ONE
+// 	power of two work-group; work-items stride over the partials first.
+__kernel void cl_residual_finalize(int ngroups, const __global REAL *partial_max,
+								const __global REAL *partial_sq, __global REAL *norms,
+								__local REAL *smax, __local REAL *ssq){
+	//[A]:Get Local ID
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	//[B]:Strided pass over the partials
+	int i;
+	REAL m = 0;
+	REAL s = 0;
+	for (i = lid; i < ngroups; i += lsize){
+		m  = fmax(m, partial_max[i]);
+		s += partial_sq[i];
+	}/*end i*/
+
+	smax[lid] = m;
+	ssq[lid]  = s;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[C]:Tree reduction in local memory
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			smax[lid] = fmax(smax[lid], smax[lid+offset]);
+			ssq[lid] += ssq[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+
+	//[D]:Write both norms
+	if (lid == 0){
+		norms[0] = smax[0];
+		norms[1] = sqrt(ssq[0]);
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Fused Jacobi Sweep and Residual 										*
+************************************************************************/
+// cl_jacobi and cl_residual_partial in one pass over A: the off-diagonal
+// 	sum s_i of row i gives x_i = (b_i - s_i)/a_ii and the residual of the
+// 	iterate read, b_i - s_i - a_ii xn_i. Same launch contract as
+// 	cl_residual_partial (power of two local size, one partial per group).
+__kernel void cl_jacobi_residual(int ny, const __global REAL *A, const __global REAL *b,
+								const __global REAL *xn, __global REAL *x,
+								__global REAL *partial_max, __global REAL *partial_sq,
+								__local REAL *smax, __local REAL *ssq){
+	//[A]:Get Global and Local IDs
+	int gid   = get_global_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	//[B]:Next iterate and row residual (padding work-items contribute zero)
+	int k;
+	REAL r = 0;
+	if (gid < ny){
+		REAL sum = 0;
+		for (k = 0; k < ny; k++){
+			if (k != gid){
+				sum += A[k+ny*gid]*xn[k];
+			}/*end if*/
+		}/*end k*/
+		REAL diag = A[gid+ny*gid];
+		x[gid] = (b[gid] - sum)/diag;
+		r = b[gid] - sum - diag*xn[gid];
+	}/*end if*/
+
+	smax[lid] = fabs(r);
+	ssq[lid]  = r*r;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[C]:Tree reduction in local memory
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			smax[lid] = fmax(smax[lid], smax[lid+offset]);
+			ssq[lid] += ssq[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+
+	//[D]:One partial per work-group
+	if (lid == 0){
+		partial_max[get_group_id(0)] = smax[0];
+		partial_sq[get_group_id(0)]  = ssq[0];
+	}/*end if*/
+}
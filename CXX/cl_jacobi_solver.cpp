@@ -0,0 +1,132 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Jacobi Solver
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_jacobi_solver.h"
+#include "cl_buffer_pool.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <stdio.h>
+
+namespace clp
+{
+
+const char* stationary_method_name(StationaryMethod method)
+{
+    switch (method)
+    {
+        case StationaryMethod::GaussSeidel:
+            return "Gauss-Seidel";
+        case StationaryMethod::Sor:
+            return "SOR";
+        default:
+            return "Jacobi";
+    }
+}
+
+JacobiSolver::JacobiSolver(JacobiOptions options) : options_(options)
+{
+    options_.check_every = std::max(1, options_.check_every);
+    if (options_.method == StationaryMethod::GaussSeidel)
+    {
+        options_.omega = 1.0;
+    }
+    if (options_.method != StationaryMethod::Jacobi && !(options_.omega > 0.0 && options_.omega < 2.0))
+    {
+        throw std::invalid_argument("JacobiSolver: SOR needs 0 < omega < 2");
+    }
+}
+
+SolveResult JacobiSolver::solve(cl::CommandQueue& queue, DeviceOperator& A, const cl::Buffer& b, cl::Buffer& x)
+{
+    ResidualNorms residual(A);
+    return solve(queue, A, b, x, residual);
+}
+
+SolveResult JacobiSolver::solve(
+    cl::CommandQueue& queue, DeviceOperator& A, const cl::Buffer& b, cl::Buffer& x, ResidualNorms& residual)
+{
+    const int n = A.rows();
+    SolveResult result;
+
+    // [A]:Each sweep reads from "cur" and writes to "next"; swapping the two
+    // 	handles replaces any per-iteration allocation or copy. The scratch
+    // 	vector comes from the buffer pool, so repeated solves reuse it
+    BufferLease scratch = BufferPool::instance().acquire(A.scalar_size() * n);
+    cl::Buffer* cur = &x;
+    cl::Buffer* next = &scratch.buffer();
+
+    int iter = 1;
+    double res = residual(queue, A, b, *cur, options_.norm);
+    if (options_.verbose)
+    {
+        printf("iter = %d | %s Residual = %f\n", iter, norm_name(options_.norm), res);
+    }
+
+    while (res > options_.tol && iter < options_.maxiter)
+    {
+        // [B]:Advance Iteration Counter and sweep; the coloured methods
+        // 	update in place, one launch per colour
+        iter += 1;
+        if (options_.method == StationaryMethod::Jacobi)
+        {
+            // A Jacobi checkpoint is measured by the sweep that follows it:
+            // 	the fused kernel reads each row of A once for both the new
+            // 	iterate and the residual of the one it reads
+            const int last = iter - 1;
+            if (last > 1 && last % options_.check_every == 0)
+            {
+                res = residual.sweep(queue, A, b, *cur, *next, options_.norm);
+                if (options_.verbose)
+                {
+                    printf("iter = %d | %s Residual = %f\n", last, norm_name(options_.norm), res);
+                }
+                if (res <= options_.tol)
+                {
+                    // Converged at "last": drop the sweep past it
+                    iter = last;
+                    break;
+                }
+            }
+            else
+            {
+                A.jacobi_sweep(queue, b, *cur, *next);
+            }  // end if
+            std::swap(cur, next);
+        }
+        else
+        {
+            for (int colour = 0; colour < A.colours(); colour++)
+            {
+                A.colour_sweep(queue, b, *cur, colour, options_.omega);
+            }  // end colour
+        }  // end if
+
+        // [C]:Only a scalar crosses back to the host, every N sweeps; Jacobi
+        // 	only needs the separate pass after its final sweep
+        const bool checkpoint = iter % options_.check_every == 0 && options_.method != StationaryMethod::Jacobi;
+        if (checkpoint || iter == options_.maxiter)
+        {
+            res = residual(queue, A, b, *cur, options_.norm);
+            if (options_.verbose)
+            {
+                printf("iter = %d | %s Residual = %f\n", iter, norm_name(options_.norm), res);
+            }
+        }  // end if
+    }  // end while
+
+    // [D]:Leave the answer in the caller's buffer
+    if (cur != &x)
+    {
+        queue.enqueueCopyBuffer(*cur, x, 0, 0, A.scalar_size() * n);
+    }
+
+    result.iterations = iter;
+    result.residual = res;
+    result.converged = res <= options_.tol;
+    return result;
+}
+
+}  // namespace clp
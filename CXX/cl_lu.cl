@@ -0,0 +1,66 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Blocked LU Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* Device steps of the blocked, right-looking LU with partial pivoting	*
+* 	(cl_lu.h). The n x n matrix is row-major with leading dimension ld.	*
+* 	Step k factors the panel of columns k .. k+nb-1 on the host; these	*
+* 	kernels then apply its row swaps to the other columns and form the	*
+* 	block row of U. The trailing update is cl_gemm.						*
+************************************************************************/
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* Row Interchanges 														*
+************************************************************************/
+// One work-item per column outside the panel [k, k+nb): applies the
+// 	panel's swaps in order, row k+i <-> row ipiv[k+i]. Neighbouring
+// 	work-items touch neighbouring words of each row.
+__kernel void cl_lu_swap(int n, int ld, int k, int nb, const __global int *ipiv,
+							__global double *A){
+	int col = get_global_id(0);
+	if (col >= n - nb){
+		return;
+	}/*end if*/
+	if (col >= k){
+		col += nb;
+	}/*end if*/
+
+	int i;
+	for (i = 0; i < nb; i++){
+		int p = ipiv[k+i];
+		if (p != k+i){
+			double tmp       = A[col + ld*(k+i)];
+			A[col + ld*(k+i)] = A[col + ld*p];
+			A[col + ld*p]     = tmp;
+		}/*end if*/
+	}/*end i*/
+}
+
+
+/************************************************************************
+* Block Row of U 														*
+************************************************************************/
+// U12 = L11^-1 A12 for the columns right of the panel, L11 being the unit
+// 	lower triangle of the nb x nb diagonal block. One work-item per column
+// 	runs the forward substitution down that column.
+__kernel void cl_lu_trsm(int n, int ld, int k, int nb, __global double *A){
+	int col = k + nb + get_global_id(0);
+	if (col >= n){
+		return;
+	}/*end if*/
+
+	int i,p;
+	for (i = 1; i < nb; i++){
+		double sum = A[col + ld*(k+i)];
+		for (p = 0; p < i; p++){
+			sum -= A[(k+p) + ld*(k+i)]*A[col + ld*(k+p)];
+		}/*end p*/
+		A[col + ld*(k+i)] = sum;
+	}/*end i*/
+}
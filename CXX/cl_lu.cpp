@@ -0,0 +1,309 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Blocked LU Factorization
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_lu.h"
+#include "cl_buffer_pool.h"
+#include "cl_profiler.h"
+#include "host_blas.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace clp
+{
+namespace
+{
+
+// Rows (or columns) per thread below which the host loops stay serial
+const int kMinChunk = 128;
+
+}  // namespace
+
+DenseLu::DenseLu(LuOptions options, host::ThreadPool& pool) : options_(options), pool_(pool)
+{
+    if (options_.block < 1)
+    {
+        throw std::invalid_argument("DenseLu: block must be positive");
+    }
+}
+
+/************************************************************************
+ * Factorization														*
+ ************************************************************************/
+
+void DenseLu::factor(int n, double* A, int lda, std::vector<int>& ipiv)
+{
+    if (n < 0 || lda < n)
+    {
+        throw std::invalid_argument("DenseLu: need n >= 0 and lda >= n");
+    }
+    ipiv.resize(n);
+    if (n == 0)
+    {
+        return;
+    }
+
+    // [A]:Host only
+    if (!options_.device_update)
+    {
+        for (int k = 0; k < n; k += options_.block)
+        {
+            const int nb = std::min(options_.block, n - k);
+            factor_panel(n, A, lda, k, nb, ipiv);
+            update_host(n, A, lda, k, nb, ipiv);
+        }  // end k
+        return;
+    }
+
+    // [B]:Device pieces and a device copy of A (leading dimension n)
+    Runtime& runtime = Runtime::instance();
+    cl::CommandQueue& queue = runtime.queue();
+    if (!gemm_)
+    {
+        cl::Program program = build_program(load_kernel_source("cl_lu.cl"));
+        swap_ = cl::Kernel(program, "cl_lu_swap");
+        trsm_ = cl::Kernel(program, "cl_lu_trsm");
+        gemm_.reset(new Dgemm(tuned_gemm_config<double>(n, n, options_.block)));
+    }
+
+    const std::size_t row_bytes = sizeof(double) * n;
+    const std::size_t host_row_bytes = sizeof(double) * lda;
+    BufferLease D_lease = BufferPool::instance().acquire(row_bytes * n);
+    BufferLease piv_lease = BufferPool::instance().acquire(sizeof(int) * n, CL_MEM_READ_ONLY);
+    cl::Buffer& D = D_lease.buffer();
+    cl::Buffer& piv = piv_lease.buffer();
+
+    const std::array<std::size_t, 3> origin = {0, 0, 0};
+    queue.enqueueWriteBufferRect(D,
+                                 CL_FALSE,
+                                 origin,
+                                 origin,
+                                 {row_bytes, static_cast<std::size_t>(n), 1},
+                                 row_bytes,
+                                 0,
+                                 host_row_bytes,
+                                 0,
+                                 A);
+
+    swap_.setArg(0, n);
+    swap_.setArg(1, n);
+    swap_.setArg(4, piv);
+    swap_.setArg(5, D);
+    trsm_.setArg(0, n);
+    trsm_.setArg(1, n);
+    trsm_.setArg(4, D);
+
+    for (int k = 0; k < n; k += options_.block)
+    {
+        const int nb = std::min(options_.block, n - k);
+        const int rest = n - k - nb;
+
+        // Panel: rows k .. n-1 of columns k .. k+nb-1, same place on both sides
+        const std::array<std::size_t, 3> panel_origin = {sizeof(double) * k, static_cast<std::size_t>(k), 0};
+        const std::array<std::size_t, 3> panel_region = {sizeof(double) * nb, static_cast<std::size_t>(n - k), 1};
+
+        // [C]:Fetch the panel (already current on the host at k = 0)
+        if (k > 0)
+        {
+            queue.enqueueReadBufferRect(D,
+                                        CL_TRUE,
+                                        panel_origin,
+                                        panel_origin,
+                                        panel_region,
+                                        row_bytes,
+                                        0,
+                                        host_row_bytes,
+                                        0,
+                                        A);
+        }
+        else
+        {
+            queue.finish();
+        }
+
+        // [D]:Factor it on the host and send it back with its pivots
+        factor_panel(n, A, lda, k, nb, ipiv);
+        queue.enqueueWriteBufferRect(D,
+                                     CL_FALSE,
+                                     panel_origin,
+                                     panel_origin,
+                                     panel_region,
+                                     row_bytes,
+                                     0,
+                                     host_row_bytes,
+                                     0,
+                                     A);
+        queue.enqueueWriteBuffer(piv, CL_FALSE, sizeof(int) * k, sizeof(int) * nb, ipiv.data() + k);
+
+        // [E]:Row interchanges on every column outside the panel
+        if (n > nb)
+        {
+            swap_.setArg(2, k);
+            swap_.setArg(3, nb);
+            queue.enqueueNDRangeKernel(
+                swap_, cl::NullRange, cl::NDRange(n - nb), cl::NullRange, nullptr, CLP_TRACE("cl_lu_swap", nullptr));
+        }
+
+        // [F]:U12 = L11^-1 A12, then A22 -= L21 U12
+        if (rest > 0)
+        {
+            trsm_.setArg(2, k);
+            trsm_.setArg(3, nb);
+            queue.enqueueNDRangeKernel(
+                trsm_, cl::NullRange, cl::NDRange(rest), cl::NullRange, nullptr, CLP_TRACE("cl_lu_trsm", nullptr));
+
+            (*gemm_)(queue,
+                     rest,
+                     rest,
+                     nb,
+                     -1.0,
+                     D,
+                     k + n * (k + nb),
+                     n,
+                     D,
+                     (k + nb) + n * k,
+                     n,
+                     1.0,
+                     D,
+                     (k + nb) + n * (k + nb),
+                     n);
+        }
+    }  // end k
+
+    // [G]:One read of the finished factors
+    queue.enqueueReadBufferRect(
+        D, CL_TRUE, origin, origin, {row_bytes, static_cast<std::size_t>(n), 1}, row_bytes, 0, host_row_bytes, 0, A);
+}
+
+void DenseLu::factor_panel(int n, double* A, int lda, int k, int nb, std::vector<int>& ipiv)
+{
+    for (int j = k; j < k + nb; j++)
+    {
+        // [A]:Pivot: largest |a_ij| on or below the diagonal
+        int p = j;
+        double best = std::fabs(A[j + lda * j]);
+        for (int i = j + 1; i < n; i++)
+        {
+            if (std::fabs(A[j + lda * i]) > best)
+            {
+                best = std::fabs(A[j + lda * i]);
+                p = i;
+            }
+        }  // end i
+        if (best == 0.0)
+        {
+            throw std::runtime_error("DenseLu: the matrix is singular (zero pivot in column " + std::to_string(j) +
+                                     ")");
+        }
+
+        // [B]:Swap inside the panel; other columns are swapped afterwards
+        ipiv[j] = p;
+        if (p != j)
+        {
+            std::swap_ranges(A + k + lda * j, A + k + nb + lda * j, A + k + lda * p);
+        }
+
+        // [C]:Multipliers and rank-1 update of the rest of the panel, split
+        // 	over the rows below the pivot
+        const double pivot = A[j + lda * j];
+        const int width = k + nb - j - 1;
+        pool_.parallel_for(
+            n - j - 1,
+            [&](int begin, int end) {
+                for (int i = j + 1 + begin; i < j + 1 + end; i++)
+                {
+                    double* row = A + lda * i;
+                    const double l = row[j] / pivot;
+                    row[j] = l;
+                    host::axpy(width, -l, A + (j + 1) + lda * j, row + j + 1);
+                }  // end i
+            },
+            kMinChunk);
+    }  // end j
+}
+
+void DenseLu::update_host(int n, double* A, int lda, int k, int nb, const std::vector<int>& ipiv)
+{
+    const int rest = n - k - nb;
+
+    // [A]:Row interchanges outside the panel, split over columns
+    pool_.parallel_for(
+        n - nb,
+        [&](int begin, int end) {
+            for (int j = k; j < k + nb; j++)
+            {
+                if (ipiv[j] == j)
+                {
+                    continue;
+                }
+                for (int c = begin; c < end; c++)
+                {
+                    const int col = c < k ? c : c + nb;
+                    std::swap(A[col + lda * j], A[col + lda * ipiv[j]]);
+                }  // end c
+            }  // end j
+        },
+        kMinChunk);
+    if (rest == 0)
+    {
+        return;
+    }
+
+    // [B]:U12 = L11^-1 A12, split over columns
+    double* U12 = A + (k + nb) + lda * k;
+    pool_.parallel_for(
+        rest,
+        [&](int begin, int end) {
+            for (int i = 1; i < nb; i++)
+            {
+                for (int p = 0; p < i; p++)
+                {
+                    host::axpy(end - begin, -A[(k + p) + lda * (k + i)], U12 + begin + lda * p, U12 + begin + lda * i);
+                }  // end p
+            }  // end i
+        },
+        kMinChunk);
+
+    // [C]:A22 -= L21 U12, split over rows
+    pool_.parallel_for(
+        rest,
+        [&](int begin, int end) {
+            const int row = k + nb + begin;
+            host::gemm(
+                end - begin, rest, nb, -1.0, A + k + lda * row, lda, U12, lda, 1.0, A + (k + nb) + lda * row, lda);
+        },
+        kMinChunk / 4);
+}
+
+/************************************************************************
+ * Solve																*
+ ************************************************************************/
+
+void lu_solve(int n, const double* LU, int lda, const std::vector<int>& ipiv, double* b)
+{
+    for (int i = 0; i < n; i++)
+    {
+        std::swap(b[i], b[ipiv[i]]);
+    }  // end i
+    host::trsv_lower(n, LU, lda, b, true);
+    host::trsv_upper(n, LU, lda, b);
+}
+
+void lu_solve(int n, int nrhs, const double* LU, int lda, const std::vector<int>& ipiv, double* B, int ldb)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if (ipiv[i] != i)
+        {
+            std::swap_ranges(B + ldb * i, B + ldb * i + nrhs, B + ldb * ipiv[i]);
+        }
+    }  // end i
+    host::trsm_lower(n, nrhs, LU, lda, B, ldb, true);
+    host::trsm_upper(n, nrhs, LU, lda, B, ldb);
+}
+
+}  // namespace clp
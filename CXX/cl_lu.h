@@ -0,0 +1,72 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Blocked LU Factorization
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Blocked, right-looking LU with partial pivoting for dense row-major	*
+ * 	systems (P A = L U). Every step factors a panel of "block" columns	*
+ * 	on the host, split over the rows of the panel by the host thread		*
+ * 	pool. The O(n^3) part, the trailing update A22 -= L21 U12, runs on	*
+ * 	the device through clp::Gemm together with the row interchanges		*
+ * 	and the block row of U (cl_lu.cl). The matrix stays on the device	*
+ * 	between steps; only the panel crosses the bus each way.				*
+ *																		*
+ * 	With device_update = false every step runs on the host (threaded	*
+ * 	host_blas.h kernels), e.g. when no OpenCL device is present.		*
+ ************************************************************************/
+
+#ifndef CXX_CL_LU_H
+#define CXX_CL_LU_H
+
+#include "cl_gemm.h"
+#include "cl_runtime.h"
+#include "host_thread_pool.h"
+#include <memory>
+#include <vector>
+
+namespace clp
+{
+
+struct LuOptions
+{
+    int block = 64;             // Panel width nb
+    bool device_update = true;  // Swaps, U12 and trailing GEMM on the device
+};
+
+class DenseLu
+{
+  public:
+    explicit DenseLu(LuOptions options = LuOptions(), host::ThreadPool& pool = host::ThreadPool::instance());
+
+    // Factors the n x n matrix A (leading dimension lda) in place: U on and
+    // 	above the diagonal, L below it with an implicit unit diagonal. Row i
+    // 	was interchanged with row ipiv[i] at step i (LAPACK convention,
+    // 	0-based). Throws std::runtime_error for a singular matrix
+    void factor(int n, double* A, int lda, std::vector<int>& ipiv);
+
+    const LuOptions& options() const { return options_; }
+
+  private:
+    void factor_panel(int n, double* A, int lda, int k, int nb, std::vector<int>& ipiv);
+    void update_host(int n, double* A, int lda, int k, int nb, const std::vector<int>& ipiv);
+
+    LuOptions options_;
+    host::ThreadPool& pool_;
+
+    // Device pieces, created on the first device factorization
+    cl::Kernel swap_;
+    cl::Kernel trsm_;
+    std::unique_ptr<Dgemm> gemm_;
+};
+
+// Solves A x = b with the output of DenseLu::factor; b is overwritten by x
+void lu_solve(int n, const double* LU, int lda, const std::vector<int>& ipiv, double* b);
+
+// Same for nrhs right-hand sides at once, B n x nrhs with leading
+// 	dimension ldb (blocked triangular solves, see host::trsm_lower)
+void lu_solve(int n, int nrhs, const double* LU, int lda, const std::vector<int>& ipiv, double* B, int ldb);
+
+}  // namespace clp
+
+#endif  // CXX_CL_LU_H
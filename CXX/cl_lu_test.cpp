@@ -0,0 +1,180 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Blocked LU Tests
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_lu.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// Row-major n x n matrix that needs pivoting: small diagonal, larger
+// 	entries elsewhere
+std::vector<double> test_matrix(int n)
+{
+    std::vector<double> A(static_cast<std::size_t>(n) * n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            A[j + n * i] = std::sin(0.37 * i + 1.13 * j + 0.5) + (i == j ? 0.01 : 0.0);
+        }  // end j
+    }  // end i
+    return A;
+}
+
+// Largest |(P A - L U)_ij|, P from the LAPACK-style ipiv
+double factor_error(int n, std::vector<double> A, const std::vector<double>& LU, const std::vector<int>& ipiv)
+{
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            std::swap(A[j + n * i], A[j + n * ipiv[i]]);
+        }  // end j
+    }  // end i
+
+    double error = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            double sum = 0.0;
+            for (int k = 0; k <= std::min(i, j); k++)
+            {
+                const double l = k == i ? 1.0 : LU[k + n * i];
+                sum += l * LU[j + n * k];
+            }  // end k
+            error = std::max(error, std::fabs(A[j + n * i] - sum));
+        }  // end j
+    }  // end i
+    return error;
+}
+
+}  // namespace
+
+TEST(LuTest, HostFactorReconstructsPA)
+{
+    for (int threads : {1, 3})
+    {
+        clp::host::ThreadPool pool(threads);
+        for (int n : {1, 5, 64, 97})
+        {
+            for (int block : {1, 7, 32, 200})
+            {
+                SCOPED_TRACE(::testing::Message() << "threads " << threads << ", n " << n << ", block " << block);
+                clp::LuOptions options;
+                options.block = block;
+                options.device_update = false;
+                clp::DenseLu lu(options, pool);
+
+                const std::vector<double> A = test_matrix(n);
+                std::vector<double> LU = A;
+                std::vector<int> ipiv;
+                lu.factor(n, LU.data(), n, ipiv);
+
+                ASSERT_EQ(static_cast<int>(ipiv.size()), n);
+                for (int i = 0; i < n; i++)
+                {
+                    EXPECT_GE(ipiv[i], i);
+                    EXPECT_LT(ipiv[i], n);
+                }  // end i
+                EXPECT_LT(factor_error(n, A, LU, ipiv), 1e-10);
+            }  // end block
+        }  // end n
+    }  // end threads
+}
+
+TEST(LuTest, HostFactorMatchesAcrossBlocks)
+{
+    // Partial pivoting picks the same rows whatever the panel width
+    const int n = 50;
+    const std::vector<double> A = test_matrix(n);
+    std::vector<int> reference;
+    for (int block : {1, 8, 64})
+    {
+        clp::LuOptions options;
+        options.block = block;
+        options.device_update = false;
+        std::vector<double> LU = A;
+        std::vector<int> ipiv;
+        clp::DenseLu(options).factor(n, LU.data(), n, ipiv);
+        if (reference.empty())
+        {
+            reference = ipiv;
+        }
+        EXPECT_EQ(ipiv, reference) << "block " << block;
+    }  // end block
+}
+
+TEST(LuTest, SolveRecoversTheRightHandSides)
+{
+    const int n = 73;
+    const int nrhs = 4;
+    const std::vector<double> A = test_matrix(n);
+
+    clp::LuOptions options;
+    options.block = 16;
+    options.device_update = false;
+    std::vector<double> LU = A;
+    std::vector<int> ipiv;
+    clp::DenseLu(options).factor(n, LU.data(), n, ipiv);
+
+    // B = A X for a known X
+    std::vector<double> X(static_cast<std::size_t>(n) * nrhs);
+    for (std::size_t i = 0; i < X.size(); i++)
+    {
+        X[i] = std::cos(0.3 * static_cast<double>(i));
+    }  // end i
+    std::vector<double> B(X.size(), 0.0);
+    for (int i = 0; i < n; i++)
+    {
+        for (int c = 0; c < nrhs; c++)
+        {
+            for (int k = 0; k < n; k++)
+            {
+                B[c + nrhs * i] += A[k + n * i] * X[c + nrhs * k];
+            }  // end k
+        }  // end c
+    }  // end i
+
+    // One column at a time, then all at once
+    for (int c = 0; c < nrhs; c++)
+    {
+        std::vector<double> b(n);
+        for (int i = 0; i < n; i++)
+        {
+            b[i] = B[c + nrhs * i];
+        }  // end i
+        clp::lu_solve(n, LU.data(), n, ipiv, b.data());
+        for (int i = 0; i < n; i++)
+        {
+            EXPECT_NEAR(b[i], X[c + nrhs * i], 1e-8) << "column " << c << ", row " << i;
+        }  // end i
+    }  // end c
+
+    clp::lu_solve(n, nrhs, LU.data(), n, ipiv, B.data(), nrhs);
+    for (std::size_t i = 0; i < X.size(); i++)
+    {
+        EXPECT_NEAR(B[i], X[i], 1e-8) << "entry " << i;
+    }  // end i
+}
+
+TEST(LuTest, SingularMatrixThrows)
+{
+    // Rank 2: row 1 = 2 row 0, which elimination cancels exactly
+    std::vector<double> A = {1, 2, 3, 2, 4, 6, 1, 1, 1};
+    clp::LuOptions options;
+    options.device_update = false;
+    std::vector<int> ipiv;
+    EXPECT_THROW(clp::DenseLu(options).factor(3, A.data(), 3, ipiv), std::runtime_error);
+
+    options.block = 0;
+    EXPECT_THROW(clp::DenseLu lu(options), std::invalid_argument);
+}
@@ -0,0 +1,114 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Multi-Device Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* Vector kernels of the multi-device solvers (cl_multidevice.h). Each	*
+* 	device runs them on its own row block; the matrix kernels come from	*
+* 	cl_sparse.cl. Dot products reduce in two passes on the device so	*
+* 	only one scalar per device is read back.							*
+************************************************************************/
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* First Touch 															*
+************************************************************************/
+// dst = src, word by word: run on the device that owns dst so that its
+// 	pages are first touched, and placed, on that device's NUMA node
+__kernel void cl_md_copy_words(int count, const __global uint *src, __global uint *dst){
+	int gid = get_global_id(0);
+	if (gid < count){
+		dst[gid] = src[gid];
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Halo Exchange 														*
+************************************************************************/
+// send[i] = x[idx[i]]: packs the owned values other blocks hold as ghosts
+__kernel void cl_md_gather(int count, const __global int *idx, const __global double *x,
+								__global double *send){
+	int gid = get_global_id(0);
+	if (gid < count){
+		send[gid] = x[idx[gid]];
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Vector Updates 														*
+************************************************************************/
+// y = a*x + b*y
+__kernel void cl_md_axpby(int n, double a, const __global double *x, double b,
+								__global double *y){
+	int gid = get_global_id(0);
+	if (gid < n){
+		y[gid] = a*x[gid] + b*y[gid];
+	}/*end if*/
+}
+
+// z = r / d (diagonal preconditioner)
+__kernel void cl_md_scale(int n, const __global double *d, const __global double *r,
+								__global double *z){
+	int gid = get_global_id(0);
+	if (gid < n){
+		z[gid] = r[gid]/d[gid];
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Dot Product 															*
+************************************************************************/
+// Tree reduces "v" over the (power of two) work-group into scratch[0]
+void reduce_sum(double v, __local double *scratch){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	scratch[lid] = v;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			scratch[lid] += scratch[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+}
+
+// Pass 1: one partial x.y per work-group
+__kernel void cl_md_dot_partial(int n, const __global double *x, const __global double *y,
+								__global double *partial, __local double *scratch){
+	int gid = get_global_id(0);
+	reduce_sum(gid < n ? x[gid]*y[gid] : 0.0, scratch);
+	if (get_local_id(0) == 0){
+		partial[get_group_id(0)] = scratch[0];
+	}/*end if*/
+}
+
+// Pass 2: ONE work-group folds the partials into sum[0]
+__kernel void cl_md_sum(int ngroups, const __global double *partial, __global double *sum,
+								__local double *scratch){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	int i;
+	double s = 0;
+	for (i = lid; i < ngroups; i += lsize){
+		s += partial[i];
+	}/*end i*/
+
+	reduce_sum(s, scratch);
+	if (lid == 0){
+		sum[0] = scratch[0];
+	}/*end if*/
+}
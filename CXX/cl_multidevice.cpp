@@ -0,0 +1,779 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Multi-Device Domain Decomposition
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_multidevice.h"
+#include "cl_profiler.h"
+#include "cl_program_cache.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <stdio.h>
+
+namespace clp
+{
+namespace
+{
+
+std::size_t work_items(int n, std::size_t local)
+{
+    return (n + local - 1) / local * local;
+}
+
+}  // namespace
+
+/************************************************************************
+ * Device Group															*
+ ************************************************************************/
+
+DeviceGroup::DeviceGroup(const std::vector<cl::Device>& devices) : devices_(devices)
+{
+    if (devices_.empty())
+    {
+        throw std::invalid_argument("DeviceGroup: needs at least one device");
+    }
+    context_ = cl::Context(devices_);
+
+    // Profiling is always on: the load balancer times every device
+    for (const cl::Device& device : devices_)
+    {
+        queues_.emplace_back(context_, device, CL_QUEUE_PROFILING_ENABLE);
+    }  // end device
+}
+
+DeviceGroup DeviceGroup::platform_devices()
+{
+    std::vector<cl::Device> devices;
+    try
+    {
+        Runtime::instance().platform().getDevices(selected_device_type(), &devices);
+    }
+    catch (const cl::Error&)
+    {
+        // CL_DEVICE_NOT_FOUND is reported as an exception
+        devices.clear();
+    }
+    return DeviceGroup(devices);
+}
+
+DeviceGroup DeviceGroup::numa_domains(cl::Device device)
+{
+    const cl_device_partition_property properties[] = {
+        CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN, CL_DEVICE_AFFINITY_DOMAIN_NUMA, 0};
+    std::vector<cl::Device> domains;
+    try
+    {
+        device.createSubDevices(properties, &domains);
+    }
+    catch (const cl::Error&)
+    {
+        // GPUs, single-socket hosts and runtimes without the partition type
+        domains.clear();
+    }
+    if (domains.empty())
+    {
+        domains.push_back(device);
+    }
+    DeviceGroup group(domains);
+    group.first_touch_ = true;
+    return group;
+}
+
+cl::Program DeviceGroup::build(const std::string& source, const std::string& options) const
+{
+    return ProgramCache::instance().build(context_, devices_, source, options);
+}
+
+std::size_t DeviceGroup::local_size(const cl::Kernel& kernel) const
+{
+    std::size_t limit = 256;
+    for (const cl::Device& device : devices_)
+    {
+        limit = std::min(limit, kernel.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device));
+    }  // end device
+    std::size_t local = 1;
+    while (local * 2 <= limit)
+    {
+        local *= 2;
+    }  // end while
+    return local;
+}
+
+void DeviceGroup::finish()
+{
+    for (cl::CommandQueue& queue : queues_)
+    {
+        queue.finish();
+    }  // end queue
+}
+
+void DeviceGroup::print() const
+{
+    for (int i = 0; i < size(); i++)
+    {
+        std::cout << "Device " << i << ": " << devices_[i].getInfo<CL_DEVICE_NAME>() << std::endl;
+    }  // end i
+    std::cout << std::endl;
+}
+
+/************************************************************************
+ * Distributed CSR Matrix												*
+ ************************************************************************/
+
+// Block d of the matrix and everything its device needs
+struct DistributedCsr::Block
+{
+    // Ghost slots [slot, slot + count) are copied from send[offset ..] of
+    // 	block "from"
+    struct Receive
+    {
+        int from;
+        int offset;
+        int slot;
+        int count;
+    };
+
+    int first = 0;  // Global row of local row 0
+    int rows = 0;
+    int ghosts = 0;
+    int nnz = 0;
+    int send_count = 0;
+    std::vector<Receive> receives;
+    std::vector<cl::Event> send_reads;  // Copies still reading "send"
+
+    cl::Buffer row_ptr;
+    cl::Buffer cols;
+    cl::Buffer vals;
+    cl::Buffer send_idx;  // Owned entries other blocks hold as ghosts
+    cl::Buffer send;
+    cl::Buffer partial_a;
+    cl::Buffer partial_b;
+    cl::Buffer result;
+
+    cl::Kernel spmv;
+    cl::Kernel jacobi;
+    cl::Kernel diagonal;
+    cl::Kernel residual;
+    cl::Kernel finalize;
+    cl::Kernel gather;
+    cl::Kernel axpby;
+    cl::Kernel scale;
+    cl::Kernel dot;
+    cl::Kernel sum;
+};
+
+DistributedCsr::DistributedCsr(DeviceGroup& group, const CsrMatrix& A, int calibration)
+    : group_(group), rows_(A.rows)
+{
+    if (A.rows != A.cols)
+    {
+        throw std::invalid_argument("DistributedCsr: the matrix must be square");
+    }
+    if (A.rows < group_.size())
+    {
+        throw std::invalid_argument("DistributedCsr: fewer rows than devices");
+    }
+    require_diagonal(A, "DistributedCsr");
+
+    // [A]:Programs for every device, and one local size for the reductions
+    sparse_ = group_.build(load_kernel_source("cl_sparse.cl"), real_options<double>());
+    jacobi_ = group_.build(load_kernel_source("cl_jacobi.cl"), real_options<double>());
+    vector_ = group_.build(load_kernel_source("cl_multidevice.cl"));
+    local_ = std::min({group_.local_size(cl::Kernel(sparse_, "cl_residual_partial_csr")),
+                       group_.local_size(cl::Kernel(jacobi_, "cl_residual_finalize")),
+                       group_.local_size(cl::Kernel(vector_, "cl_md_dot_partial")),
+                       group_.local_size(cl::Kernel(vector_, "cl_md_sum"))});
+
+    // [B]:Equal work first, then in proportion to the measured speed
+    build(A, std::vector<double>(group_.size(), 1.0));
+    if (calibration > 0 && parts() > 1)
+    {
+        throughput_ = calibrate(calibration);
+        build(A, throughput_);
+    }
+}
+
+DistributedCsr::~DistributedCsr() = default;
+
+void DistributedCsr::build(const CsrMatrix& A, const std::vector<double>& weights)
+{
+    const int parts = group_.size();
+    blocks_.assign(parts, Block());
+
+    // [A]:Row split: block d ends where the running work (nonzeros plus one
+    // 	per row) first reaches its share, keeping at least one row each
+    const double total = static_cast<double>(A.nnz()) + A.rows;
+    double weight_sum = 0.0;
+    for (double w : weights)
+    {
+        weight_sum += w;
+    }  // end w
+    offsets_.assign(parts + 1, 0);
+    offsets_[parts] = A.rows;
+    double share = 0.0;
+    int row = 0;
+    for (int d = 0; d < parts - 1; d++)
+    {
+        share += weights[d] / weight_sum;
+        while (row < A.rows - (parts - 1 - d) &&
+               (row <= offsets_[d] || A.row_ptr[row] + row < share * total))
+        {
+            row++;
+        }  // end while
+        offsets_[d + 1] = row;
+    }  // end d
+
+    // [B]:Local numbering: owned columns first, then the ghosts in global
+    // 	order, which groups them by owner
+    std::vector<std::vector<int>> send_lists(parts);
+    for (int d = 0; d < parts; d++)
+    {
+        Block& block = blocks_[d];
+        block.first = offsets_[d];
+        block.rows = offsets_[d + 1] - offsets_[d];
+        const int last = offsets_[d + 1];
+
+        std::vector<int> ghosts;
+        for (int k = A.row_ptr[block.first]; k < A.row_ptr[last]; k++)
+        {
+            if (A.col_idx[k] < block.first || A.col_idx[k] >= last)
+            {
+                ghosts.push_back(A.col_idx[k]);
+            }
+        }  // end k
+        std::sort(ghosts.begin(), ghosts.end());
+        ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+        block.ghosts = static_cast<int>(ghosts.size());
+
+        std::vector<int> row_ptr(block.rows + 1, 0);
+        std::vector<int> cols;
+        std::vector<double> vals;
+        for (int i = 0; i < block.rows; i++)
+        {
+            for (int k = A.row_ptr[block.first + i]; k < A.row_ptr[block.first + i + 1]; k++)
+            {
+                const int col = A.col_idx[k];
+                if (col >= block.first && col < last)
+                {
+                    cols.push_back(col - block.first);
+                }
+                else
+                {
+                    const auto ghost = std::lower_bound(ghosts.begin(), ghosts.end(), col);
+                    cols.push_back(block.rows + static_cast<int>(ghost - ghosts.begin()));
+                }  // end if
+                vals.push_back(A.values[k]);
+            }  // end k
+            row_ptr[i + 1] = static_cast<int>(cols.size());
+        }  // end i
+        block.nnz = static_cast<int>(cols.size());
+
+        // [C]:One receive per owner; the owner appends the entries to its
+        // 	send list
+        for (int g = 0; g < block.ghosts;)
+        {
+            const int from = static_cast<int>(std::upper_bound(offsets_.begin(), offsets_.end(), ghosts[g]) -
+                                              offsets_.begin()) - 1;
+            Block::Receive receive{from, static_cast<int>(send_lists[from].size()), g, 0};
+            while (g < block.ghosts && ghosts[g] < offsets_[from + 1])
+            {
+                send_lists[from].push_back(ghosts[g] - offsets_[from]);
+                receive.count++;
+                g++;
+            }  // end while
+            block.receives.push_back(receive);
+        }  // end g
+
+        // [D]:Matrix block on the device (a block of empty rows still
+        // 	gets one-entry arrays)
+        block.row_ptr = upload(d, row_ptr.data(), sizeof(int) * row_ptr.size(), CL_MEM_READ_ONLY);
+        block.cols = upload(d,
+                            cols.empty() ? nullptr : cols.data(),
+                            sizeof(int) * std::max<std::size_t>(cols.size(), 1),
+                            CL_MEM_READ_ONLY);
+        block.vals = upload(d,
+                            vals.empty() ? nullptr : vals.data(),
+                            sizeof(double) * std::max<std::size_t>(vals.size(), 1),
+                            CL_MEM_READ_ONLY);
+    }  // end d
+
+    // [E]:Send lists, reduction scratch and kernels
+    for (int d = 0; d < parts; d++)
+    {
+        Block& block = blocks_[d];
+        const cl::Context& context = group_.context();
+        block.send_count = static_cast<int>(send_lists[d].size());
+        if (block.send_count > 0)
+        {
+            block.send_idx = upload(d, send_lists[d].data(), sizeof(int) * block.send_count, CL_MEM_READ_ONLY);
+            block.send = cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(double) * block.send_count);
+        }
+        const int groups = static_cast<int>(work_items(block.rows, local_) / local_);
+        block.partial_a = cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(double) * groups);
+        block.partial_b = cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(double) * groups);
+        block.result = cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(double) * 2);
+        const cl::LocalSpaceArg scratch = cl::Local(sizeof(double) * local_);
+
+        block.spmv = cl::Kernel(sparse_, "cl_spmv_csr");
+        block.jacobi = cl::Kernel(sparse_, "cl_jacobi_csr");
+        block.diagonal = cl::Kernel(sparse_, "cl_diagonal_csr");
+        block.residual = cl::Kernel(sparse_, "cl_residual_partial_csr");
+        for (cl::Kernel* kernel : {&block.spmv, &block.jacobi, &block.diagonal, &block.residual})
+        {
+            kernel->setArg(0, block.rows);
+            kernel->setArg(1, block.row_ptr);
+            kernel->setArg(2, block.cols);
+            kernel->setArg(3, block.vals);
+        }  // end kernel
+        block.residual.setArg(6, block.partial_a);
+        block.residual.setArg(7, block.partial_b);
+        block.residual.setArg(8, scratch);
+        block.residual.setArg(9, scratch);
+
+        block.finalize = cl::Kernel(jacobi_, "cl_residual_finalize");
+        block.finalize.setArg(0, groups);
+        block.finalize.setArg(1, block.partial_a);
+        block.finalize.setArg(2, block.partial_b);
+        block.finalize.setArg(3, block.result);
+        block.finalize.setArg(4, scratch);
+        block.finalize.setArg(5, scratch);
+
+        block.gather = cl::Kernel(vector_, "cl_md_gather");
+        if (block.send_count > 0)
+        {
+            block.gather.setArg(0, block.send_count);
+            block.gather.setArg(1, block.send_idx);
+            block.gather.setArg(3, block.send);
+        }
+        block.axpby = cl::Kernel(vector_, "cl_md_axpby");
+        block.axpby.setArg(0, block.rows);
+        block.scale = cl::Kernel(vector_, "cl_md_scale");
+        block.scale.setArg(0, block.rows);
+        block.dot = cl::Kernel(vector_, "cl_md_dot_partial");
+        block.dot.setArg(0, block.rows);
+        block.dot.setArg(3, block.partial_a);
+        block.dot.setArg(4, scratch);
+        block.sum = cl::Kernel(vector_, "cl_md_sum");
+        block.sum.setArg(0, groups);
+        block.sum.setArg(1, block.partial_a);
+        block.sum.setArg(2, block.result);
+        block.sum.setArg(3, scratch);
+    }  // end d
+}
+
+std::vector<double> DistributedCsr::calibrate(int products)
+{
+    // Every device times "products" of its own block at once; the
+    // 	throughput is nonzeros per second of device time
+    DeviceVector x = make_vector(std::vector<double>(rows_, 1.0));
+    DeviceVector y = make_vector();
+    exchange(x);
+
+    std::vector<std::vector<cl::Event>> events(parts(), std::vector<cl::Event>(products));
+    for (int i = 0; i < products; i++)
+    {
+        for (int d = 0; d < parts(); d++)
+        {
+            Block& block = blocks_[d];
+            block.spmv.setArg(4, x[d]);
+            block.spmv.setArg(5, y[d]);
+            group_.queue(d).enqueueNDRangeKernel(block.spmv,
+                                                 cl::NullRange,
+                                                 cl::NDRange(block.rows),
+                                                 cl::NullRange,
+                                                 nullptr,
+                                                 CLP_TRACE("cl_spmv_csr", &events[d][i]));
+        }  // end d
+    }  // end i
+
+    std::vector<double> throughput(parts());
+    for (int d = 0; d < parts(); d++)
+    {
+        cl::Event::waitForEvents(events[d]);
+        double seconds = 0.0;
+        for (const cl::Event& event : events[d])
+        {
+            seconds += 1e-9 * (event.getProfilingInfo<CL_PROFILING_COMMAND_END>() -
+                               event.getProfilingInfo<CL_PROFILING_COMMAND_START>());
+        }  // end event
+        throughput[d] = (blocks_[d].nnz + blocks_[d].rows) * products / std::max(seconds, 1e-9);
+    }  // end d
+    return throughput;
+}
+
+DeviceVector DistributedCsr::make_vector(const std::vector<double>& values)
+{
+    DeviceVector v;
+    for (int d = 0; d < parts(); d++)
+    {
+        const Block& block = blocks_[d];
+        std::vector<double> local(block.rows + block.ghosts, 0.0);
+        if (!values.empty())
+        {
+            std::copy(values.begin() + block.first, values.begin() + block.first + block.rows, local.begin());
+        }
+        v.push_back(upload(d, local.data(), sizeof(double) * local.size(), CL_MEM_READ_WRITE));
+    }  // end d
+    return v;
+}
+
+void DistributedCsr::gather(DeviceVector& v, std::vector<double>& values)
+{
+    values.resize(rows_);
+    for (int d = 0; d < parts(); d++)
+    {
+        group_.queue(d).enqueueReadBuffer(
+            v[d], CL_FALSE, 0, sizeof(double) * blocks_[d].rows, values.data() + blocks_[d].first);
+    }  // end d
+    for (int d = 0; d < parts(); d++)
+    {
+        group_.queue(d).finish();
+    }  // end d
+}
+
+void DistributedCsr::exchange(DeviceVector& x)
+{
+    // [A]:Every owner packs its outgoing values, once the copies of the
+    // 	previous exchange are done reading them
+    std::vector<cl::Event> packed(parts());
+    for (int d = 0; d < parts(); d++)
+    {
+        Block& block = blocks_[d];
+        if (block.send_count == 0)
+        {
+            continue;
+        }
+        std::vector<cl::Event> wait;
+        wait.swap(block.send_reads);
+        block.gather.setArg(2, x[d]);
+        group_.queue(d).enqueueNDRangeKernel(block.gather,
+                                             cl::NullRange,
+                                             cl::NDRange(block.send_count),
+                                             cl::NullRange,
+                                             wait.empty() ? nullptr : &wait,
+                                             CLP_TRACE("cl_md_gather", &packed[d]));
+    }  // end d
+
+    // [B]:Each block copies its ghosts on its own queue, after the pack
+    for (int d = 0; d < parts(); d++)
+    {
+        Block& block = blocks_[d];
+        for (const Block::Receive& receive : block.receives)
+        {
+            const std::vector<cl::Event> wait{packed[receive.from]};
+            cl::Event copied;
+            group_.queue(d).enqueueCopyBuffer(blocks_[receive.from].send,
+                                              x[d],
+                                              sizeof(double) * receive.offset,
+                                              sizeof(double) * (block.rows + receive.slot),
+                                              sizeof(double) * receive.count,
+                                              &wait,
+                                              CLP_TRACE("halo copy", &copied));
+            blocks_[receive.from].send_reads.push_back(copied);
+        }  // end receive
+    }  // end d
+}
+
+void DistributedCsr::enqueue(int part, cl::Kernel& kernel, std::size_t work_items, const char* name)
+{
+    group_.queue(part).enqueueNDRangeKernel(
+        kernel, cl::NullRange, cl::NDRange(work_items), cl::NullRange, nullptr, CLP_TRACE(name, nullptr));
+}
+
+cl::Buffer DistributedCsr::upload(int part, const void* data, std::size_t bytes, cl_mem_flags flags)
+{
+    const cl::Context& context = group_.context();
+    if (data == nullptr)
+    {
+        return cl::Buffer(context, flags, bytes);
+    }
+    if (!group_.first_touch())
+    {
+        return cl::Buffer(context, flags | CL_MEM_COPY_HOST_PTR, bytes, const_cast<void*>(data));
+    }
+
+    // The staging buffer wraps "data"; the copy runs on the cores of
+    // 	block "part", so they are the first to touch the new pages
+    cl::Buffer staging(context, CL_MEM_READ_ONLY | CL_MEM_USE_HOST_PTR, bytes, const_cast<void*>(data));
+    cl::Buffer buffer(context, flags, bytes);
+    cl::Kernel copy(vector_, "cl_md_copy_words");
+    const int words = static_cast<int>(bytes / sizeof(cl_uint));
+    copy.setArg(0, words);
+    copy.setArg(1, staging);
+    copy.setArg(2, buffer);
+    enqueue(part, copy, words, "cl_md_copy_words");
+    group_.queue(part).finish();  // "data" may go out of scope
+    return buffer;
+}
+
+void DistributedCsr::apply(DeviceVector& x, DeviceVector& y)
+{
+    for (int d = 0; d < parts(); d++)
+    {
+        blocks_[d].spmv.setArg(4, x[d]);
+        blocks_[d].spmv.setArg(5, y[d]);
+        enqueue(d, blocks_[d].spmv, blocks_[d].rows, "cl_spmv_csr");
+    }  // end d
+}
+
+void DistributedCsr::jacobi_sweep(const DeviceVector& b, DeviceVector& x, DeviceVector& x_next)
+{
+    for (int d = 0; d < parts(); d++)
+    {
+        blocks_[d].jacobi.setArg(4, b[d]);
+        blocks_[d].jacobi.setArg(5, x[d]);
+        blocks_[d].jacobi.setArg(6, x_next[d]);
+        enqueue(d, blocks_[d].jacobi, blocks_[d].rows, "cl_jacobi_csr");
+    }  // end d
+}
+
+void DistributedCsr::diagonal(DeviceVector& diag)
+{
+    for (int d = 0; d < parts(); d++)
+    {
+        blocks_[d].diagonal.setArg(4, diag[d]);
+        enqueue(d, blocks_[d].diagonal, blocks_[d].rows, "cl_diagonal_csr");
+    }  // end d
+}
+
+void DistributedCsr::axpby(double a, const DeviceVector& x, double b, DeviceVector& y)
+{
+    for (int d = 0; d < parts(); d++)
+    {
+        blocks_[d].axpby.setArg(1, a);
+        blocks_[d].axpby.setArg(2, x[d]);
+        blocks_[d].axpby.setArg(3, b);
+        blocks_[d].axpby.setArg(4, y[d]);
+        enqueue(d, blocks_[d].axpby, blocks_[d].rows, "cl_md_axpby");
+    }  // end d
+}
+
+void DistributedCsr::scale(const DeviceVector& diag, const DeviceVector& r, DeviceVector& z)
+{
+    for (int d = 0; d < parts(); d++)
+    {
+        blocks_[d].scale.setArg(1, diag[d]);
+        blocks_[d].scale.setArg(2, r[d]);
+        blocks_[d].scale.setArg(3, z[d]);
+        enqueue(d, blocks_[d].scale, blocks_[d].rows, "cl_md_scale");
+    }  // end d
+}
+
+double DistributedCsr::dot(const DeviceVector& x, const DeviceVector& y)
+{
+    // [A]:Both passes on every device before the first read blocks
+    std::vector<double> sums(parts());
+    for (int d = 0; d < parts(); d++)
+    {
+        Block& block = blocks_[d];
+        cl::CommandQueue& queue = group_.queue(d);
+        block.dot.setArg(1, x[d]);
+        block.dot.setArg(2, y[d]);
+        queue.enqueueNDRangeKernel(block.dot,
+                                   cl::NullRange,
+                                   cl::NDRange(work_items(block.rows, local_)),
+                                   cl::NDRange(local_),
+                                   nullptr,
+                                   CLP_TRACE("cl_md_dot_partial", nullptr));
+        queue.enqueueNDRangeKernel(block.sum,
+                                   cl::NullRange,
+                                   cl::NDRange(local_),
+                                   cl::NDRange(local_),
+                                   nullptr,
+                                   CLP_TRACE("cl_md_sum", nullptr));
+        queue.enqueueReadBuffer(block.result, CL_FALSE, 0, sizeof(double), &sums[d]);
+    }  // end d
+
+    // [B]:Sum of the block sums
+    double sum = 0.0;
+    for (int d = 0; d < parts(); d++)
+    {
+        group_.queue(d).finish();
+        sum += sums[d];
+    }  // end d
+    return sum;
+}
+
+BlockNorms DistributedCsr::residual(const DeviceVector& b, DeviceVector& x)
+{
+    std::vector<double> norms(2 * parts());
+    for (int d = 0; d < parts(); d++)
+    {
+        Block& block = blocks_[d];
+        cl::CommandQueue& queue = group_.queue(d);
+        block.residual.setArg(4, b[d]);
+        block.residual.setArg(5, x[d]);
+        queue.enqueueNDRangeKernel(block.residual,
+                                   cl::NullRange,
+                                   cl::NDRange(work_items(block.rows, local_)),
+                                   cl::NDRange(local_),
+                                   nullptr,
+                                   CLP_TRACE("cl_residual_partial_csr", nullptr));
+        queue.enqueueNDRangeKernel(block.finalize,
+                                   cl::NullRange,
+                                   cl::NDRange(local_),
+                                   cl::NDRange(local_),
+                                   nullptr,
+                                   CLP_TRACE("cl_residual_finalize", nullptr));
+        queue.enqueueReadBuffer(block.result, CL_FALSE, 0, sizeof(double) * 2, &norms[2 * d]);
+    }  // end d
+
+    // Max of the block maxima, root of the summed squares
+    BlockNorms result;
+    for (int d = 0; d < parts(); d++)
+    {
+        group_.queue(d).finish();
+        result.inf = std::max(result.inf, norms[2 * d]);
+        result.two += norms[2 * d + 1] * norms[2 * d + 1];
+    }  // end d
+    result.two = std::sqrt(result.two);
+    return result;
+}
+
+void DistributedCsr::print_partition() const
+{
+    for (int d = 0; d < parts(); d++)
+    {
+        const Block& block = blocks_[d];
+        printf("Block %d: rows %d .. %d (%d rows, %d nonzeros, %d ghosts)",
+               d,
+               block.first,
+               block.first + block.rows - 1,
+               block.rows,
+               block.nnz,
+               block.ghosts);
+        if (!throughput_.empty())
+        {
+            printf(", measured %.1f M nonzeros/s", 1e-6 * throughput_[d]);
+        }
+        printf("\n");
+    }  // end d
+}
+
+/************************************************************************
+ * Solvers																*
+ ************************************************************************/
+
+SolveResult multi_device_jacobi(DistributedCsr& A,
+                                const std::vector<double>& b,
+                                std::vector<double>& x,
+                                const JacobiOptions& options)
+{
+    if (options.method != StationaryMethod::Jacobi)
+    {
+        throw std::invalid_argument("multi_device_jacobi: only the Jacobi method is split across devices");
+    }
+    SolveResult result;
+    const int check_every = std::max(1, options.check_every);
+
+    // [A]:Ping-pong iterates; only "cur" needs its ghosts
+    DeviceVector b_dev = A.make_vector(b);
+    DeviceVector cur = A.make_vector(x);
+    DeviceVector next = A.make_vector();
+
+    int iter = 1;
+    A.exchange(cur);
+    double res = A.residual(b_dev, cur).get(options.norm);
+    if (options.verbose)
+    {
+        printf("iter = %d | %s Residual = %f\n", iter, norm_name(options.norm), res);
+    }
+
+    while (res > options.tol && iter < options.maxiter)
+    {
+        // [B]:Advance Iteration Counter, sweep, then refresh the halo
+        iter += 1;
+        A.jacobi_sweep(b_dev, cur, next);
+        std::swap(cur, next);
+        A.exchange(cur);
+
+        // [C]:One scalar per device crosses back, every N sweeps
+        if (iter % check_every == 0 || iter == options.maxiter)
+        {
+            res = A.residual(b_dev, cur).get(options.norm);
+            if (options.verbose)
+            {
+                printf("iter = %d | %s Residual = %f\n", iter, norm_name(options.norm), res);
+            }
+        }  // end if
+    }  // end while
+
+    A.gather(cur, x);
+    result.iterations = iter;
+    result.residual = res;
+    result.converged = res <= options.tol;
+    return result;
+}
+
+SolveResult multi_device_cg(DistributedCsr& A,
+                            const std::vector<double>& b,
+                            std::vector<double>& x,
+                            const CgOptions& options)
+{
+    SolveResult result;
+    const int check_every = std::max(1, options.check_every);
+
+    // [A]:r = b - Ax, z = M^-1 r, p = z with M = diag(A)
+    DeviceVector x_dev = A.make_vector(x);
+    DeviceVector r = A.make_vector(b);
+    DeviceVector z = A.make_vector();
+    DeviceVector p = A.make_vector();
+    DeviceVector q = A.make_vector();
+    DeviceVector diag = A.make_vector();
+    A.diagonal(diag);
+    A.exchange(x_dev);
+    A.apply(x_dev, q);
+    A.axpby(-1.0, q, 1.0, r);
+    A.scale(diag, r, z);
+    A.axpby(1.0, z, 0.0, p);
+    double rz = A.dot(r, z);
+    double res = std::sqrt(A.dot(r, r));
+
+    int iter = 0;
+    if (options.verbose)
+    {
+        printf("iter = %d | L2 Residual = %f\n", iter, res);
+    }
+
+    while (res > options.tol && iter < options.maxiter)
+    {
+        // [B]:Step along p; only p is read through A, so only p is exchanged
+        iter += 1;
+        A.exchange(p);
+        A.apply(p, q);
+        const double alpha = rz / A.dot(p, q);
+        A.axpby(alpha, p, 1.0, x_dev);
+        A.axpby(-alpha, q, 1.0, r);
+
+        // [C]:Residual check every N iterations
+        if (iter % check_every == 0 || iter == options.maxiter)
+        {
+            res = std::sqrt(A.dot(r, r));
+            if (options.verbose)
+            {
+                printf("iter = %d | L2 Residual = %f\n", iter, res);
+            }
+            if (res <= options.tol)
+            {
+                break;
+            }
+        }  // end if
+
+        // [D]:New direction
+        A.scale(diag, r, z);
+        const double rz_next = A.dot(r, z);
+        A.axpby(1.0, z, rz_next / rz, p);
+        rz = rz_next;
+    }  // end while
+
+    A.gather(x_dev, x);
+    result.iterations = iter;
+    result.residual = res;
+    result.converged = res <= options.tol;
+    return result;
+}
+
+}  // namespace clp
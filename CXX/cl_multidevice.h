@@ -0,0 +1,190 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Multi-Device Domain Decomposition
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * One solve spread over every device of a context. A CSR matrix is		*
+ * 	split into contiguous row blocks, one per device; each block keeps	*
+ * 	its rows with the columns renumbered into [owned | ghost], where	*
+ * 	the ghosts are the off-block entries of x its rows reference.		*
+ * 	Before every product the owners pack those values on their own		*
+ * 	queue and each block copies them into its ghost slots, ordered by	*
+ * 	events only: no device waits on the host for the halo exchange.		*
+ *																		*
+ * 	The split follows measured speed: the matrix is first cut into		*
+ * 	blocks of equal work (nonzeros plus rows), every device times a		*
+ * 	few products of its block, and the rows are cut again in			*
+ * 	proportion to the measured throughput.								*
+ *																		*
+ * 	Devices in one context must share a platform; the default group is	*
+ * 	every device of the runtime's platform matching CLP_DEVICE_TYPE.	*
+ * 	Double precision only.												*
+ *																		*
+ * 	On multi-socket hosts numa_domains() splits one CPU device into		*
+ * 	sub-devices, one per NUMA node (CL_DEVICE_PARTITION_BY_AFFINITY_	*
+ * 	DOMAIN). Such a group places memory by first touch: every block's	*
+ * 	buffers are filled by a copy kernel on the block's own sub-device,	*
+ * 	so their pages land on that node and the sweeps never cross the		*
+ * 	socket interconnect except for the halo.							*
+ ************************************************************************/
+
+#ifndef CXX_CL_MULTIDEVICE_H
+#define CXX_CL_MULTIDEVICE_H
+
+#include "cl_cg_solver.h"
+#include "cl_jacobi_solver.h"
+#include "cl_runtime.h"
+#include "cl_sparse.h"
+#include <string>
+#include <vector>
+
+namespace clp
+{
+
+/************************************************************************
+ * Device Group															*
+ ************************************************************************/
+
+// Devices sharing one context, with one in-order queue each
+class DeviceGroup
+{
+  public:
+    // Throws std::invalid_argument for an empty list
+    explicit DeviceGroup(const std::vector<cl::Device>& devices);
+
+    // Every device of the runtime's platform matching CLP_DEVICE_TYPE
+    static DeviceGroup platform_devices();
+
+    // One sub-device per NUMA node of "device", placing memory by first
+    // 	touch; just "device" when it cannot be split that way
+    static DeviceGroup numa_domains(cl::Device device);
+
+    int size() const { return static_cast<int>(devices_.size()); }
+    const cl::Context& context() const { return context_; }
+    const std::vector<cl::Device>& devices() const { return devices_; }
+    const cl::Device& device(int index) const { return devices_.at(index); }
+    cl::CommandQueue& queue(int index) { return queues_.at(index); }
+
+    // Fill buffers on the device that will use them, not from the host
+    bool first_touch() const { return first_touch_; }
+
+    // Program built for every device of the group (through the binary cache)
+    cl::Program build(const std::string& source, const std::string& options = "-cl-std=CL2.0") const;
+
+    // Largest power of two work-group, up to 256, every device accepts
+    std::size_t local_size(const cl::Kernel& kernel) const;
+
+    // Waits for every queue
+    void finish();
+
+    void print() const;
+
+  private:
+    std::vector<cl::Device> devices_;
+    cl::Context context_;
+    std::vector<cl::CommandQueue> queues_;
+    bool first_touch_ = false;
+};
+
+/************************************************************************
+ * Distributed CSR Matrix												*
+ ************************************************************************/
+
+// One buffer per block: the block's owned entries, then its ghost slots
+using DeviceVector = std::vector<cl::Buffer>;
+
+struct BlockNorms
+{
+    double inf = 0.0;  // ||b - Ax||_inf
+    double two = 0.0;  // ||b - Ax||_2
+
+    double get(Norm norm) const { return norm == Norm::Inf ? inf : two; }
+};
+
+class DistributedCsr
+{
+  public:
+    // Splits the square matrix A over the devices of "group", balanced by
+    // 	measured throughput after "calibration" timed products per device
+    // 	(0 keeps the equal-work split)
+    DistributedCsr(DeviceGroup& group, const CsrMatrix& A, int calibration = 5);
+    ~DistributedCsr();
+
+    DistributedCsr(const DistributedCsr&) = delete;
+    DistributedCsr& operator=(const DistributedCsr&) = delete;
+
+    int rows() const { return rows_; }
+    int parts() const { return static_cast<int>(offsets_.size()) - 1; }
+    DeviceGroup& group() { return group_; }
+
+    // Block d owns global rows [row_offsets()[d], row_offsets()[d+1])
+    const std::vector<int>& row_offsets() const { return offsets_; }
+
+    // Nonzeros per second of each device in the calibration, else empty
+    const std::vector<double>& throughput() const { return throughput_; }
+
+    // Vector with room for the ghosts; "values" (rows() long) or zeros
+    DeviceVector make_vector(const std::vector<double>& values = std::vector<double>());
+
+    // Reads the owned parts back into one host vector
+    void gather(DeviceVector& v, std::vector<double>& values);
+
+    // Fills the ghost slots of x from their owners
+    void exchange(DeviceVector& x);
+
+    // Block-local kernels; x must have been exchanged where it is read
+    // 	through A
+    void apply(DeviceVector& x, DeviceVector& y);
+    void jacobi_sweep(const DeviceVector& b, DeviceVector& x, DeviceVector& x_next);
+    void diagonal(DeviceVector& d);
+    void axpby(double a, const DeviceVector& x, double b, DeviceVector& y);
+    void scale(const DeviceVector& d, const DeviceVector& r, DeviceVector& z);
+
+    // Blocking reductions over every block
+    double dot(const DeviceVector& x, const DeviceVector& y);
+    BlockNorms residual(const DeviceVector& b, DeviceVector& x);
+
+    void print_partition() const;
+
+  private:
+    struct Block;
+
+    void build(const CsrMatrix& A, const std::vector<double>& weights);
+    std::vector<double> calibrate(int products);
+    void enqueue(int part, cl::Kernel& kernel, std::size_t work_items, const char* name);
+
+    // Device buffer of block "part" holding "bytes" of "data"
+    cl::Buffer upload(int part, const void* data, std::size_t bytes, cl_mem_flags flags);
+
+    DeviceGroup& group_;
+    int rows_;
+    std::vector<int> offsets_;
+    std::vector<Block> blocks_;
+    std::vector<double> throughput_;
+    cl::Program sparse_;
+    cl::Program jacobi_;
+    cl::Program vector_;
+    std::size_t local_;
+};
+
+/************************************************************************
+ * Solvers																*
+ ************************************************************************/
+
+// Jacobi on every device of A's group; options.method must be Jacobi.
+// 	x holds the initial guess and receives the solution
+SolveResult multi_device_jacobi(DistributedCsr& A,
+                                const std::vector<double>& b,
+                                std::vector<double>& x,
+                                const JacobiOptions& options = JacobiOptions());
+
+// Diagonally preconditioned CG on every device of A's group
+SolveResult multi_device_cg(DistributedCsr& A,
+                            const std::vector<double>& b,
+                            std::vector<double>& x,
+                            const CgOptions& options = CgOptions());
+
+}  // namespace clp
+
+#endif  // CXX_CL_MULTIDEVICE_H
@@ -0,0 +1,141 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Geometric Multigrid Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* Grid transfers and the smoother update of the multigrid V-cycle		*
+* 	(cl_multigrid.h). Grids are the nx x ny x nz interior points of		*
+* 	cl_stencil.cl, x fastest, with extent 1 along unused axes; "dims"	*
+* 	counts the used ones. Coarse point I sits on fine point 2I+1 along	*
+* 	every used axis, so a fine axis of n points has (n-1)/2 coarse		*
+* 	points. Everything outside a grid is the zero Dirichlet boundary.	*
+************************************************************************/
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* Smoother and Residual 												*
+************************************************************************/
+// Weighted Jacobi: x += omega (x_jacobi - x), x_jacobi from one sweep of
+// 	the level's stencil operator
+__kernel void cl_mg_relax(int n, double omega, const __global double *x_jacobi, __global double *x){
+	int gid = get_global_id(0);
+	if (gid < n){
+		x[gid] += omega*(x_jacobi[gid] - x[gid]);
+	}/*end if*/
+}
+
+// r = b - r, where r holds A*x on entry
+__kernel void cl_mg_residual(int n, const __global double *b, __global double *r){
+	int gid = get_global_id(0);
+	if (gid < n){
+		r[gid] = b[gid] - r[gid];
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Restriction 															*
+************************************************************************/
+// Full weighting, (1/4, 1/2, 1/4) along every used axis, times 4: the
+// 	stencils are not scaled by 1/h^2, so the coarse system of spacing 2h
+// 	is A_2h e = 4 R r. Launch on (cx, cy, cz).
+__kernel void cl_mg_restrict(int dims, int nx, int ny, int cx, int cy, int cz,
+								const __global double *r, __global double *rc){
+	//[A]:Coarse point and the fine point under it
+	int I = get_global_id(0);
+	int J = get_global_id(1);
+	int K = get_global_id(2);
+	if (I >= cx || J >= cy || K >= cz){
+		return;
+	}/*end if*/
+
+	int ry = dims > 1 ? 1 : 0;
+	int rz = dims > 2 ? 1 : 0;
+	int i0 = 2*I + 1;
+	int j0 = ry ? 2*J + 1 : 0;
+	int k0 = rz ? 2*K + 1 : 0;
+
+	//[B]:Tensor product of the 1-D weights (1, 2, 1) / 4
+	int di, dj, dk;
+	double sum = 0;
+	for (dk = -rz; dk <= rz; dk++){
+		for (dj = -ry; dj <= ry; dj++){
+			for (di = -1; di <= 1; di++){
+				double w = (di ? 0.5 : 1.0)*(dj ? 0.5 : 1.0)*(dk ? 0.5 : 1.0);
+				sum += w*r[(i0+di) + nx*((j0+dj) + ny*(k0+dk))];
+			}/*end di*/
+		}/*end dj*/
+	}/*end dk*/
+
+	rc[I + cx*(J + cy*K)] = 4.0*sum/(1 << dims);
+}
+
+
+
+/************************************************************************
+* Prolongation 															*
+************************************************************************/
+// Coarse neighbours of fine index i along one axis of cn coarse points:
+// 	an odd i sits on coarse (i-1)/2, an even i lies halfway between i/2-1
+// 	and i/2. Returns how many of them are inside the coarse grid.
+int coarse_neighbours(int i, int cn, int used, int *c, double *w){
+	int count = 0;
+	if (!used){
+		c[0] = 0;
+		w[0] = 1.0;
+		return 1;
+	}/*end if*/
+	if (i & 1){
+		if ((i-1)/2 < cn){
+			c[count] = (i-1)/2;
+			w[count++] = 1.0;
+		}/*end if*/
+		return count;
+	}/*end if*/
+	if (i/2 - 1 >= 0){
+		c[count] = i/2 - 1;
+		w[count++] = 0.5;
+	}/*end if*/
+	if (i/2 < cn){
+		c[count] = i/2;
+		w[count++] = 0.5;
+	}/*end if*/
+	return count;
+}
+
+// x += P e, (bi/tri)linear interpolation of the coarse correction. Launch
+// 	on (nx, ny, nz).
+__kernel void cl_mg_prolong(int dims, int nx, int ny, int nz, int cx, int cy,
+								int cz, const __global double *e, __global double *x){
+	//[A]:Fine point
+	int i = get_global_id(0);
+	int j = get_global_id(1);
+	int k = get_global_id(2);
+	if (i >= nx || j >= ny || k >= nz){
+		return;
+	}/*end if*/
+
+	//[B]:Coarse neighbours along each axis
+	int ci[2], cj[2], ck[2];
+	double wi[2], wj[2], wk[2];
+	int ni = coarse_neighbours(i, cx, 1, ci, wi);
+	int nj = coarse_neighbours(j, cy, dims > 1, cj, wj);
+	int nk = coarse_neighbours(k, cz, dims > 2, ck, wk);
+
+	//[C]:Interpolate
+	int a, c, d;
+	double sum = 0;
+	for (d = 0; d < nk; d++){
+		for (c = 0; c < nj; c++){
+			for (a = 0; a < ni; a++){
+				sum += wi[a]*wj[c]*wk[d]*e[ci[a] + cx*(cj[c] + cy*ck[d])];
+			}/*end a*/
+		}/*end c*/
+	}/*end d*/
+	x[i + nx*(j + ny*k)] += sum;
+}
@@ -0,0 +1,267 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Geometric Multigrid
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_multigrid.h"
+#include "cl_profiler.h"
+#include "host_blas.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <stdio.h>
+
+namespace clp
+{
+namespace
+{
+
+// The coarsest grid is factored densely (n^2 doubles), so it may exceed
+// 	coarse_size by at most this factor
+const int kCoarseMargin = 8;
+
+// Dense row-major copy of the stencil of an nx x ny x nz grid
+std::vector<double> dense_stencil(int nx, int ny, int nz, int dims)
+{
+    const int n = nx * ny * nz;
+    std::vector<double> A(static_cast<std::size_t>(n) * n, 0.0);
+    int i, j, k;
+    for (k = 0; k < nz; k++)
+    {
+        for (j = 0; j < ny; j++)
+        {
+            for (i = 0; i < nx; i++)
+            {
+                const int row = i + nx * (j + ny * k);
+                double* a = A.data() + static_cast<std::size_t>(n) * row;
+                a[row] = 2.0 * dims;
+                const int neighbours[6][2] = {{i > 0, -1},
+                                              {i < nx - 1, 1},
+                                              {j > 0, -nx},
+                                              {j < ny - 1, nx},
+                                              {k > 0, -nx * ny},
+                                              {k < nz - 1, nx * ny}};
+                for (const auto& neighbour : neighbours)
+                {
+                    if (neighbour[0])
+                    {
+                        a[row + neighbour[1]] = -1.0;
+                    }
+                }  // end neighbour
+            }  // end i
+        }  // end j
+    }  // end k
+    return A;
+}
+
+}  // namespace
+
+Multigrid::Multigrid(int nx, int ny, int nz, MultigridOptions options)
+    : options_(options), dims_(1 + (ny > 0) + (nz > 0))
+{
+    if (options_.omega == 0.0)
+    {
+        options_.omega = 2.0 * dims_ / (2.0 * dims_ + 1.0);
+    }
+    if (options_.omega <= 0.0 || options_.omega > 1.0 || options_.pre_smooth < 0 || options_.post_smooth < 0)
+    {
+        throw std::invalid_argument("Multigrid: expected 0 < omega <= 1 and non-negative smoothing sweeps");
+    }
+    options_.coarse_size = std::max(1, options_.coarse_size);
+    options_.max_levels = std::max(1, options_.max_levels);
+
+    // [A]:Levels; a used axis of n points coarsens to (n-1)/2 of them
+    BufferPool& pool = BufferPool::instance();
+    int extent[3] = {nx, ny, nz};
+    while (true)
+    {
+        Level level;
+        level.nx = extent[0];
+        level.ny = std::max(extent[1], 1);
+        level.nz = std::max(extent[2], 1);
+        level.A.reset(new StencilOperator<double>(extent[0], extent[1], extent[2]));
+        const int n = level.A->rows();
+        if (!levels_.empty())
+        {
+            level.b = pool.acquire(sizeof(double) * n);
+            level.x = pool.acquire(sizeof(double) * n);
+        }
+        level.r = pool.acquire(sizeof(double) * n);
+        level.t = pool.acquire(sizeof(double) * n);
+        levels_.push_back(std::move(level));
+
+        bool coarsen = n > options_.coarse_size && levels() < options_.max_levels;
+        for (int d = 0; d < dims_; d++)
+        {
+            coarsen = coarsen && (extent[d] - 1) / 2 >= 1;
+        }  // end d
+        if (!coarsen)
+        {
+            break;
+        }
+        for (int d = 0; d < dims_; d++)
+        {
+            extent[d] = (extent[d] - 1) / 2;
+        }  // end d
+    }  // end while
+
+    // A thin grid stops coarsening once its shortest axis is one point and
+    // 	would leave a huge coarsest level; refuse it before the dense factor
+    const int coarse_rows = levels_.back().A->rows();
+    if (coarse_rows > static_cast<long long>(kCoarseMargin) * options_.coarse_size)
+    {
+        throw std::invalid_argument("Multigrid: the coarsest grid keeps " + std::to_string(coarse_rows) +
+                                    " unknowns, more than " + std::to_string(kCoarseMargin) +
+                                    " x coarse_size; use extents of similar size or more levels");
+    }
+
+    // [B]:Transfer and smoother kernels
+    cl::Program program = build_program(load_kernel_source("cl_multigrid.cl"));
+    relax_ = cl::Kernel(program, "cl_mg_relax");
+    residual_ = cl::Kernel(program, "cl_mg_residual");
+    restrict_ = cl::Kernel(program, "cl_mg_restrict");
+    prolong_ = cl::Kernel(program, "cl_mg_prolong");
+    relax_.setArg(1, options_.omega);
+    restrict_.setArg(0, dims_);
+    prolong_.setArg(0, dims_);
+
+    // [C]:Coarsest grid factored once on the host; the stencil is SPD and
+    // 	diagonally dominant, so no pivoting is needed
+    const Level& coarse = levels_.back();
+    coarse_lu_ = dense_stencil(coarse.nx, coarse.ny, coarse.nz, dims_);
+    coarse_rhs_.resize(coarse.A->rows());
+    if (host::lu_inplace(coarse.A->rows(), coarse_lu_.data(), coarse.A->rows()) >= 0)
+    {
+        throw std::runtime_error("Multigrid: the coarse grid matrix is singular");
+    }
+}
+
+/************************************************************************
+ * V-Cycle																*
+ ************************************************************************/
+
+void Multigrid::smooth(cl::CommandQueue& queue, Level& level, const cl::Buffer& b, cl::Buffer& x, int sweeps)
+{
+    const int n = level.A->rows();
+    relax_.setArg(0, n);
+    relax_.setArg(2, level.t.buffer());
+    relax_.setArg(3, x);
+    for (int sweep = 0; sweep < sweeps; sweep++)
+    {
+        level.A->jacobi_sweep(queue, b, x, level.t.buffer());
+        queue.enqueueNDRangeKernel(
+            relax_, cl::NullRange, cl::NDRange(n), cl::NullRange, nullptr, CLP_TRACE("cl_mg_relax", nullptr));
+    }  // end sweep
+}
+
+void Multigrid::coarse_solve(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x)
+{
+    // The write back is not waited on: the next blocking read of an in-order
+    // 	queue only starts once it has finished with coarse_rhs_
+    const int n = static_cast<int>(coarse_rhs_.size());
+    queue.enqueueReadBuffer(
+        b, CL_TRUE, 0, sizeof(double) * n, coarse_rhs_.data(), nullptr, CLP_TRACE("read coarse rhs", nullptr));
+    host::trsv_lower(n, coarse_lu_.data(), n, coarse_rhs_.data(), true);
+    host::trsv_upper(n, coarse_lu_.data(), n, coarse_rhs_.data());
+    queue.enqueueWriteBuffer(
+        x, CL_FALSE, 0, sizeof(double) * n, coarse_rhs_.data(), nullptr, CLP_TRACE("write coarse solution", nullptr));
+}
+
+void Multigrid::vcycle(cl::CommandQueue& queue, int level, const cl::Buffer& b, cl::Buffer& x)
+{
+    if (level == levels() - 1)
+    {
+        coarse_solve(queue, b, x);
+        return;
+    }
+    Level& fine = levels_[level];
+    Level& coarse = levels_[level + 1];
+    const int n = fine.A->rows();
+    const int nc = coarse.A->rows();
+
+    // [A]:Pre-smooth, then r = b - Ax
+    smooth(queue, fine, b, x, options_.pre_smooth);
+    fine.A->apply(queue, x, fine.r.buffer());
+    residual_.setArg(0, n);
+    residual_.setArg(1, b);
+    residual_.setArg(2, fine.r.buffer());
+    queue.enqueueNDRangeKernel(
+        residual_, cl::NullRange, cl::NDRange(n), cl::NullRange, nullptr, CLP_TRACE("cl_mg_residual", nullptr));
+
+    // [B]:Coarse right hand side and correction from zero
+    restrict_.setArg(1, fine.nx);
+    restrict_.setArg(2, fine.ny);
+    restrict_.setArg(3, coarse.nx);
+    restrict_.setArg(4, coarse.ny);
+    restrict_.setArg(5, coarse.nz);
+    restrict_.setArg(6, fine.r.buffer());
+    restrict_.setArg(7, coarse.b.buffer());
+    queue.enqueueNDRangeKernel(restrict_,
+                               cl::NullRange,
+                               cl::NDRange(coarse.nx, coarse.ny, coarse.nz),
+                               cl::NullRange,
+                               nullptr,
+                               CLP_TRACE("cl_mg_restrict", nullptr));
+    queue.enqueueFillBuffer(coarse.x.buffer(), 0.0, 0, sizeof(double) * nc);
+    vcycle(queue, level + 1, coarse.b.buffer(), coarse.x.buffer());
+
+    // [C]:x += P e, then post-smooth
+    prolong_.setArg(1, fine.nx);
+    prolong_.setArg(2, fine.ny);
+    prolong_.setArg(3, fine.nz);
+    prolong_.setArg(4, coarse.nx);
+    prolong_.setArg(5, coarse.ny);
+    prolong_.setArg(6, coarse.nz);
+    prolong_.setArg(7, coarse.x.buffer());
+    prolong_.setArg(8, x);
+    queue.enqueueNDRangeKernel(prolong_,
+                               cl::NullRange,
+                               cl::NDRange(fine.nx, fine.ny, fine.nz),
+                               cl::NullRange,
+                               nullptr,
+                               CLP_TRACE("cl_mg_prolong", nullptr));
+    smooth(queue, fine, b, x, options_.post_smooth);
+}
+
+void Multigrid::cycle(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x)
+{
+    vcycle(queue, 0, b, x);
+}
+
+void Multigrid::apply(cl::CommandQueue& queue, const cl::Buffer& r, cl::Buffer& z)
+{
+    queue.enqueueFillBuffer(z, 0.0, 0, sizeof(double) * fine_operator().rows());
+    vcycle(queue, 0, r, z);
+}
+
+/************************************************************************
+ * Standalone Solver													*
+ ************************************************************************/
+
+SolveResult Multigrid::solve(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x)
+{
+    SolveResult result;
+    ResidualNorms residual(fine_operator());
+    double res = residual(queue, fine_operator(), b, x, options_.norm);
+    if (options_.verbose)
+    {
+        printf("cycle = 0 | %s Residual = %e\n", norm_name(options_.norm), res);
+    }
+
+    while (res > options_.tol && result.iterations < options_.maxiter)
+    {
+        cycle(queue, b, x);
+        result.iterations += 1;
+        res = residual(queue, fine_operator(), b, x, options_.norm);
+        if (options_.verbose)
+        {
+            printf("cycle = %d | %s Residual = %e\n", result.iterations, norm_name(options_.norm), res);
+        }
+    }  // end while
+
+    result.residual = res;
+    result.converged = res <= options_.tol;
+    return result;
+}
+
+}  // namespace clp
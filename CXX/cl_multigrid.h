@@ -0,0 +1,107 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Geometric Multigrid
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Geometric multigrid V-cycles for the structured-grid Poisson			*
+ * 	problems of cl_stencil.h (1-D, 2-D or 3-D, Dirichlet boundaries).	*
+ * 	Every level is a matrix-free StencilOperator on a grid with half	*
+ * 	the spacing of the one above; a cycle smooths with weighted Jacobi,	*
+ * 	restricts the residual by full weighting, corrects from the next	*
+ * 	level through linear interpolation (cl_multigrid.cl) and smooths	*
+ * 	again. The coarsest grid is LU-factored once on the host and		*
+ * 	solved directly there.												*
+ *																		*
+ * 	The work of a cycle is linear in the unknowns and the number of		*
+ * 	cycles to a given tolerance does not grow with the grid, so			*
+ * 	time-to-solution scales linearly. Multigrid runs standalone with	*
+ * 	solve(), or as a CgSolver preconditioner: with equal pre- and post-	*
+ * 	smoothing one V-cycle from zero is a symmetric positive definite M.	*
+ *																		*
+ * 	Extents of 2^k - 1 points (e.g. 4095) coarsen exactly; other		*
+ * 	extents drop their last point on every level and converge more		*
+ * 	slowly. Double precision only, like cl_cg.cl.						*
+ ************************************************************************/
+
+#ifndef CXX_CL_MULTIGRID_H
+#define CXX_CL_MULTIGRID_H
+
+#include "cl_buffer_pool.h"
+#include "cl_cg_solver.h"
+#include "cl_stencil.h"
+#include <memory>
+#include <vector>
+
+namespace clp
+{
+
+struct MultigridOptions
+{
+    int pre_smooth = 2;     // Weighted Jacobi sweeps before the coarse correction
+    int post_smooth = 2;    // ... and after it
+    double omega = 0.0;     // Jacobi weight; 0 picks 2d / (2d + 1), e.g. 2/3 in 1-D
+    int coarse_size = 256;  // Coarsen until a grid has at most this many unknowns
+    int max_levels = 20;
+    double tol = 1e-8;      // Target ||b - Ax|| of solve()
+    int maxiter = 50;       // V-cycles of solve()
+    Norm norm = Norm::Inf;  // ||b - Ax||_inf or ||b - Ax||_2
+    bool verbose = true;    // Print the residual after every cycle of solve()
+};
+
+class Multigrid : public Preconditioner
+{
+  public:
+    // Hierarchy for the nx (x ny (x nz)) grid of StencilOperator; throws
+    // 	std::invalid_argument on a bad grid or smoother, or when the grid
+    // 	cannot coarsen to near coarse_size (e.g. 65535 x 3, whose short
+    // 	axis stops every axis at one level)
+    explicit Multigrid(int nx, int ny = 0, int nz = 0, MultigridOptions options = MultigridOptions());
+
+    // Fine-grid operator, e.g. the A of a preconditioned CgSolver
+    StencilOperator<double>& fine_operator() { return *levels_.front().A; }
+    int levels() const { return static_cast<int>(levels_.size()); }
+
+    // V-cycles on A x = b until the residual meets options().tol; x holds
+    // 	the initial guess and receives the solution
+    SolveResult solve(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x);
+
+    // One V-cycle improving x
+    void cycle(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x);
+
+    // z = M^-1 r: one V-cycle from z = 0
+    void apply(cl::CommandQueue& queue, const cl::Buffer& r, cl::Buffer& z) override;
+
+    const MultigridOptions& options() const { return options_; }
+
+  private:
+    struct Level
+    {
+        int nx;
+        int ny;
+        int nz;
+        std::unique_ptr<StencilOperator<double>> A;
+        BufferLease b;  // Right hand side and iterate of the coarse levels
+        BufferLease x;
+        BufferLease r;  // Residual
+        BufferLease t;  // Jacobi sweep
+    };
+
+    void vcycle(cl::CommandQueue& queue, int level, const cl::Buffer& b, cl::Buffer& x);
+    void smooth(cl::CommandQueue& queue, Level& level, const cl::Buffer& b, cl::Buffer& x, int sweeps);
+    void coarse_solve(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x);
+
+    MultigridOptions options_;
+    int dims_;
+    std::vector<Level> levels_;
+    cl::Kernel relax_;
+    cl::Kernel residual_;
+    cl::Kernel restrict_;
+    cl::Kernel prolong_;
+    std::vector<double> coarse_lu_;   // Unpivoted LU of the coarsest stencil
+    std::vector<double> coarse_rhs_;  // Host copy of its right hand side
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_MULTIGRID_H
@@ -0,0 +1,291 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Device Operators
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_operator.h"
+#include "cl_profiler.h"
+#include "cl_sparse.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace clp
+{
+namespace
+{
+
+// Build options matching an operator's scalar
+std::string scalar_options(std::size_t scalar_size)
+{
+    return scalar_size == sizeof(float) ? real_options<float>() : real_options<double>();
+}
+
+// Tuning key of a kernel built for the operator's scalar, e.g.
+// 	"cl_spmv_csr<float>": the fp32 and fp64 builds differ in their best
+// 	and their largest local size
+std::string scalar_kernel_name(const std::string& kernel, std::size_t scalar_size)
+{
+    return kernel + "<" + (scalar_size == sizeof(float) ? cl_type_name<float>() : cl_type_name<double>()) + ">";
+}
+
+}  // namespace
+
+/************************************************************************
+ * Kernel-Backed Operator												*
+ ************************************************************************/
+
+KernelOperator::KernelOperator(int rows,
+                               std::size_t scalar_size,
+                               int matrix_args,
+                               const cl::Program& program,
+                               const std::string& apply_kernel,
+                               const std::string& diagonal_kernel,
+                               const std::string& sweep_kernel,
+                               const std::string& sor_kernel,
+                               const std::string& residual_kernel,
+                               const std::string& fused_kernel)
+    : rows_(rows),
+      scalar_size_(scalar_size),
+      matrix_args_(matrix_args),
+      apply_(program, apply_kernel.c_str()),
+      diagonal_(program, diagonal_kernel.c_str()),
+      sweep_(program, sweep_kernel.c_str()),
+      sor_(program, sor_kernel.c_str()),
+      residual_(program, residual_kernel.c_str()),
+      fused_(program, fused_kernel.c_str()),
+      apply_range_(scalar_kernel_name(apply_kernel, scalar_size)),
+      diagonal_range_(scalar_kernel_name(diagonal_kernel, scalar_size)),
+      sweep_range_(scalar_kernel_name(sweep_kernel, scalar_size))
+{
+    if (rows_ < 1)
+    {
+        throw std::invalid_argument("KernelOperator: the matrix needs at least one row");
+    }
+}
+
+void KernelOperator::apply(cl::CommandQueue& queue, const cl::Buffer& x, cl::Buffer& y)
+{
+    apply_.setArg(matrix_args_, x);
+    apply_.setArg(matrix_args_ + 1, y);
+    apply_range_.enqueue(queue, apply_, rows_);
+}
+
+void KernelOperator::diagonal(cl::CommandQueue& queue, cl::Buffer& d)
+{
+    diagonal_.setArg(matrix_args_, d);
+    diagonal_range_.enqueue(queue, diagonal_, rows_);
+}
+
+void KernelOperator::jacobi_sweep(cl::CommandQueue& queue, const cl::Buffer& b, const cl::Buffer& x, cl::Buffer& x_next)
+{
+    sweep_.setArg(matrix_args_, b);
+    sweep_.setArg(matrix_args_ + 1, x);
+    sweep_.setArg(matrix_args_ + 2, x_next);
+    sweep_range_.enqueue(queue, sweep_, rows_);
+}
+
+void KernelOperator::bind_colouring(Colouring colouring)
+{
+    if (colouring.colours() < 1 || static_cast<int>(colouring.rows.size()) != rows_)
+    {
+        throw std::invalid_argument("KernelOperator: the colouring does not cover every row");
+    }
+    colouring_ = std::move(colouring);
+    colour_rows_ = cl::Buffer(Runtime::instance().context(),
+                              CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                              sizeof(int) * colouring_.rows.size(),
+                              colouring_.rows.data());
+    sor_.setArg(matrix_args_ + 2, colour_rows_);
+}
+
+void KernelOperator::colour_sweep(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x, int colour, double omega)
+{
+    const int first = colouring_.colour_ptr[colour];
+    const int count = colouring_.colour_ptr[colour + 1] - first;
+    sor_.setArg(matrix_args_, b);
+    sor_.setArg(matrix_args_ + 1, x);
+    sor_.setArg(matrix_args_ + 3, first);
+    sor_.setArg(matrix_args_ + 4, count);
+    if (scalar_size_ == sizeof(float))
+    {
+        sor_.setArg(matrix_args_ + 5, static_cast<float>(omega));
+    }
+    else
+    {
+        sor_.setArg(matrix_args_ + 5, omega);
+    }
+
+    // Not auto-tuned: a tuning sweep would relax x again
+    queue.enqueueNDRangeKernel(
+        sor_, cl::NullRange, cl::NDRange(count), cl::NullRange, nullptr, CLP_TRACE("cl_sor", nullptr));
+}
+
+void KernelOperator::residual_partials(cl::CommandQueue& queue,
+                                       const cl::Buffer& b,
+                                       const cl::Buffer& x,
+                                       cl::Buffer& partial_max,
+                                       cl::Buffer& partial_sq,
+                                       std::size_t local)
+{
+    residual_.setArg(matrix_args_, b);
+    residual_.setArg(matrix_args_ + 1, x);
+    residual_.setArg(matrix_args_ + 2, partial_max);
+    residual_.setArg(matrix_args_ + 3, partial_sq);
+    residual_.setArg(matrix_args_ + 4, cl::Local(scalar_size_ * local));
+    residual_.setArg(matrix_args_ + 5, cl::Local(scalar_size_ * local));
+
+    const std::size_t groups = (rows_ + local - 1) / local;
+    queue.enqueueNDRangeKernel(residual_,
+                               cl::NullRange,
+                               cl::NDRange(groups * local),
+                               cl::NDRange(local),
+                               nullptr,
+                               CLP_TRACE(residual_.getInfo<CL_KERNEL_FUNCTION_NAME>(), nullptr));
+}
+
+void KernelOperator::jacobi_residual_sweep(cl::CommandQueue& queue,
+                                           const cl::Buffer& b,
+                                           const cl::Buffer& x,
+                                           cl::Buffer& x_next,
+                                           cl::Buffer& partial_max,
+                                           cl::Buffer& partial_sq,
+                                           std::size_t local)
+{
+    fused_.setArg(matrix_args_, b);
+    fused_.setArg(matrix_args_ + 1, x);
+    fused_.setArg(matrix_args_ + 2, x_next);
+    fused_.setArg(matrix_args_ + 3, partial_max);
+    fused_.setArg(matrix_args_ + 4, partial_sq);
+    fused_.setArg(matrix_args_ + 5, cl::Local(scalar_size_ * local));
+    fused_.setArg(matrix_args_ + 6, cl::Local(scalar_size_ * local));
+
+    // The local size is fixed by the partials it writes, so not auto-tuned
+    const std::size_t groups = (rows_ + local - 1) / local;
+    queue.enqueueNDRangeKernel(fused_,
+                               cl::NullRange,
+                               cl::NDRange(groups * local),
+                               cl::NDRange(local),
+                               nullptr,
+                               CLP_TRACE(fused_.getInfo<CL_KERNEL_FUNCTION_NAME>(), nullptr));
+}
+
+std::size_t KernelOperator::residual_local_limit() const
+{
+    const cl::Device& device = Runtime::instance().device();
+    return std::min(residual_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device),
+                    fused_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device));
+}
+
+/************************************************************************
+ * Dense Operator														*
+ ************************************************************************/
+
+template <typename Real>
+DenseOperator<Real>::DenseOperator(const double* A, int n)
+    : KernelOperator(n,
+                     sizeof(Real),
+                     2,
+                     build_program(load_kernel_source("cl_jacobi.cl"), real_options<Real>()),
+                     "cl_matvec",
+                     "cl_diagonal",
+                     "cl_jacobi",
+                     "cl_sor",
+                     "cl_residual_partial",
+                     "cl_jacobi_residual")
+{
+    std::vector<Real> values(A, A + static_cast<std::size_t>(n) * n);
+    A_ = cl::Buffer(Runtime::instance().context(),
+                    CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                    sizeof(Real) * values.size(),
+                    values.data());
+    bind_matrix(0, n);
+    bind_matrix(1, A_);
+    bind_colouring(greedy_colouring(csr_from_dense(A, n, n)));
+}
+
+template class DenseOperator<float>;
+template class DenseOperator<double>;
+
+/************************************************************************
+ * Residual Norms														*
+ ************************************************************************/
+
+const char* norm_name(Norm norm)
+{
+    return norm == Norm::Inf ? "Max" : "L2";
+}
+
+ResidualNorms::ResidualNorms(const DeviceOperator& A) : scalar_size_(A.scalar_size())
+{
+    cl::Program program = build_program(load_kernel_source("cl_jacobi.cl"), scalar_options(scalar_size_));
+    finalize_ = cl::Kernel(program, "cl_residual_finalize");
+
+    // [A]:One power of two local size for both passes
+    const std::size_t limit = std::min(
+        A.residual_local_limit(),
+        finalize_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(Runtime::instance().device()));
+    local_ = 1;
+    while (local_ * 2 <= limit && local_ * 2 <= 256)
+    {
+        local_ *= 2;
+    }  // end while
+    groups_ = static_cast<int>((A.rows() + local_ - 1) / local_);
+
+    // [B]:Partials and the {inf norm, 2 norm} pair
+    BufferPool& pool = BufferPool::instance();
+    partial_max_ = pool.acquire(scalar_size_ * groups_);
+    partial_sq_ = pool.acquire(scalar_size_ * groups_);
+    norms_ = pool.acquire(scalar_size_ * 2, CL_MEM_WRITE_ONLY);
+
+    finalize_.setArg(0, groups_);
+    finalize_.setArg(1, partial_max_.buffer());
+    finalize_.setArg(2, partial_sq_.buffer());
+    finalize_.setArg(3, norms_.buffer());
+    finalize_.setArg(4, cl::Local(scalar_size_ * local_));
+    finalize_.setArg(5, cl::Local(scalar_size_ * local_));
+}
+
+double ResidualNorms::operator()(cl::CommandQueue& queue,
+                                 DeviceOperator& A,
+                                 const cl::Buffer& b,
+                                 const cl::Buffer& x,
+                                 Norm norm)
+{
+    A.residual_partials(queue, b, x, partial_max_.buffer(), partial_sq_.buffer(), local_);
+    return finish(queue, norm);
+}
+
+double ResidualNorms::sweep(cl::CommandQueue& queue,
+                            DeviceOperator& A,
+                            const cl::Buffer& b,
+                            const cl::Buffer& x,
+                            cl::Buffer& x_next,
+                            Norm norm)
+{
+    A.jacobi_residual_sweep(queue, b, x, x_next, partial_max_.buffer(), partial_sq_.buffer(), local_);
+    return finish(queue, norm);
+}
+
+double ResidualNorms::finish(cl::CommandQueue& queue, Norm norm)
+{
+    double value;
+    float single;
+    queue.enqueueNDRangeKernel(finalize_,
+                               cl::NullRange,
+                               cl::NDRange(local_),
+                               cl::NDRange(local_),
+                               nullptr,
+                               CLP_TRACE("cl_residual_finalize", nullptr));
+    queue.enqueueReadBuffer(norms_.buffer(),
+                            CL_TRUE,
+                            scalar_size_ * static_cast<int>(norm),
+                            scalar_size_,
+                            scalar_size_ == sizeof(float) ? static_cast<void*>(&single) : &value,
+                            nullptr,
+                            CLP_TRACE("read residual", nullptr));
+    return scalar_size_ == sizeof(float) ? single : value;
+}
+
+}  // namespace clp
@@ -0,0 +1,267 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Device Operators
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * A square system matrix living on the device, as seen by the			*
+ * 	iterative solvers. Each storage format (dense here, CSR/ELL in		*
+ * 	cl_sparse.h) supplies y = A*x, its diagonal, one Jacobi sweep and	*
+ * 	the first pass of the residual norms; the solver drivers only ever	*
+ * 	talk to this interface, so the iterate never leaves the device.		*
+ *																		*
+ * 	The concrete operators are templated on the device scalar (float	*
+ * 	or double, the REAL of their kernels); vectors passed to an			*
+ * 	operator hold that same type.										*
+ ************************************************************************/
+
+#ifndef CXX_CL_OPERATOR_H
+#define CXX_CL_OPERATOR_H
+
+#include "cl_autotune.h"
+#include "cl_buffer_pool.h"
+#include "cl_runtime.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace clp
+{
+
+/************************************************************************
+ * Row Colouring														*
+ ************************************************************************/
+
+// Colour c holds rows[colour_ptr[c] .. colour_ptr[c+1]). No two rows of one
+// 	colour reference each other (in A or A^T), so a Gauss-Seidel pass may
+// 	update all of them at once. See greedy_colouring() in cl_sparse.h
+struct Colouring
+{
+    std::vector<int> colour_ptr;
+    std::vector<int> rows;
+
+    int colours() const { return static_cast<int>(colour_ptr.size()) - 1; }
+};
+
+/************************************************************************
+ * Operator Interface													*
+ ************************************************************************/
+
+class DeviceOperator
+{
+  public:
+    virtual ~DeviceOperator() = default;
+
+    virtual int rows() const = 0;
+
+    // sizeof the scalar of its matrix and vectors: float or double
+    virtual std::size_t scalar_size() const = 0;
+
+    // y = A*x
+    virtual void apply(cl::CommandQueue& queue, const cl::Buffer& x, cl::Buffer& y) = 0;
+
+    // d = diag(A)
+    virtual void diagonal(cl::CommandQueue& queue, cl::Buffer& d) = 0;
+
+    // x_next = D^-1 (b - (A - D) x)
+    virtual void jacobi_sweep(cl::CommandQueue& queue,
+                              const cl::Buffer& b,
+                              const cl::Buffer& x,
+                              cl::Buffer& x_next) = 0;
+
+    // Colours of colour_sweep; 2 (red-black) for 1-D and 5-point Poisson
+    virtual int colours() const = 0;
+
+    // In-place pass over the rows of one colour, relaxed by omega:
+    // 	x_i += omega ((b_i - sum_{j != i} a_ij x_j) / a_ii - x_i)
+    // 	All colours in turn make one Gauss-Seidel (omega = 1) or SOR sweep
+    virtual void colour_sweep(cl::CommandQueue& queue,
+                              const cl::Buffer& b,
+                              cl::Buffer& x,
+                              int colour,
+                              double omega) = 0;
+
+    // Pass 1 of the residual norms: one partial max|b - Ax| and one partial
+    // 	sum (b - Ax)^2 per work-group of "local" rows (a power of two)
+    virtual void residual_partials(cl::CommandQueue& queue,
+                                   const cl::Buffer& b,
+                                   const cl::Buffer& x,
+                                   cl::Buffer& partial_max,
+                                   cl::Buffer& partial_sq,
+                                   std::size_t local) = 0;
+
+    // jacobi_sweep and residual_partials of x in one pass over A: the
+    // 	off-diagonal sum of row i gives both x_next_i and b_i - (Ax)_i
+    virtual void jacobi_residual_sweep(cl::CommandQueue& queue,
+                                       const cl::Buffer& b,
+                                       const cl::Buffer& x,
+                                       cl::Buffer& x_next,
+                                       cl::Buffer& partial_max,
+                                       cl::Buffer& partial_sq,
+                                       std::size_t local) = 0;
+
+    // Largest work-group residual_partials and jacobi_residual_sweep can
+    // 	be launched with
+    virtual std::size_t residual_local_limit() const = 0;
+};
+
+/************************************************************************
+ * Kernel-Backed Operator												*
+ ************************************************************************/
+
+// Shared launch code for operators whose kernels take the matrix arguments
+// 	first and the vectors after them, as every kernel in cl_jacobi.cl and
+// 	cl_sparse.cl does:
+// 		apply(    <matrix>, x, y)
+// 		diagonal( <matrix>, d)
+// 		sweep(    <matrix>, b, xn, x)
+// 		sor(      <matrix>, b, x, rows, first, count, omega)
+// 		residual( <matrix>, b, x, partial_max, partial_sq, smax, ssq)
+// 		fused(    <matrix>, b, xn, x, partial_max, partial_sq, smax, ssq)
+// 	Subclasses build the program, bind <matrix> with bind_matrix() and
+// 	hand over their row colouring with bind_colouring()
+class KernelOperator : public DeviceOperator
+{
+  public:
+    int rows() const override { return rows_; }
+    std::size_t scalar_size() const override { return scalar_size_; }
+
+    void apply(cl::CommandQueue& queue, const cl::Buffer& x, cl::Buffer& y) override;
+    void diagonal(cl::CommandQueue& queue, cl::Buffer& d) override;
+    void jacobi_sweep(cl::CommandQueue& queue, const cl::Buffer& b, const cl::Buffer& x, cl::Buffer& x_next) override;
+    int colours() const override { return colouring_.colours(); }
+    void colour_sweep(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x, int colour, double omega) override;
+    void residual_partials(cl::CommandQueue& queue,
+                           const cl::Buffer& b,
+                           const cl::Buffer& x,
+                           cl::Buffer& partial_max,
+                           cl::Buffer& partial_sq,
+                           std::size_t local) override;
+    void jacobi_residual_sweep(cl::CommandQueue& queue,
+                               const cl::Buffer& b,
+                               const cl::Buffer& x,
+                               cl::Buffer& x_next,
+                               cl::Buffer& partial_max,
+                               cl::Buffer& partial_sq,
+                               std::size_t local) override;
+    std::size_t residual_local_limit() const override;
+
+  protected:
+    // "matrix_args" is the number of leading <matrix> arguments, the
+    // 	program was built for a scalar of "scalar_size" bytes
+    KernelOperator(int rows,
+                   std::size_t scalar_size,
+                   int matrix_args,
+                   const cl::Program& program,
+                   const std::string& apply_kernel,
+                   const std::string& diagonal_kernel,
+                   const std::string& sweep_kernel,
+                   const std::string& sor_kernel,
+                   const std::string& residual_kernel,
+                   const std::string& fused_kernel);
+
+    // Sets argument "index" of every kernel
+    template <typename T>
+    void bind_matrix(int index, const T& value)
+    {
+        apply_.setArg(index, value);
+        diagonal_.setArg(index, value);
+        sweep_.setArg(index, value);
+        sor_.setArg(index, value);
+        residual_.setArg(index, value);
+        fused_.setArg(index, value);
+    }
+
+    void bind_colouring(Colouring colouring);
+
+  private:
+    int rows_;
+    std::size_t scalar_size_;
+    int matrix_args_;
+    cl::Kernel apply_;
+    cl::Kernel diagonal_;
+    cl::Kernel sweep_;
+    cl::Kernel sor_;
+    cl::Kernel residual_;
+    cl::Kernel fused_;
+    TunedRange apply_range_;
+    TunedRange diagonal_range_;
+    TunedRange sweep_range_;
+    Colouring colouring_;
+    cl::Buffer colour_rows_;
+};
+
+// Row-major n x n matrix (cl_jacobi.cl), stored on the device as Real
+template <typename Real>
+class DenseOperator : public KernelOperator
+{
+  public:
+    DenseOperator(const double* A, int n);
+
+  private:
+    cl::Buffer A_;
+};
+
+extern template class DenseOperator<float>;
+extern template class DenseOperator<double>;
+
+/************************************************************************
+ * Residual Norms														*
+ ************************************************************************/
+
+// Index of each norm in the output of cl_residual_finalize
+enum class Norm
+{
+    Inf = 0,
+    Two = 1
+};
+
+const char* norm_name(Norm norm);
+
+// Two pass ||b - Ax|| on the device: the operator writes per-group
+// 	partials, cl_residual_finalize folds them in one work-group and only
+// 	the requested scalar is read back. Works in the operator's precision
+class ResidualNorms
+{
+  public:
+    explicit ResidualNorms(const DeviceOperator& A);
+
+    // Blocks on the read back of the scalar
+    double operator()(cl::CommandQueue& queue, DeviceOperator& A, const cl::Buffer& b, const cl::Buffer& x, Norm norm);
+
+    // Jacobi sweep x -> x_next that also returns ||b - Ax|| of the iterate
+    // 	it read, with a single pass over A (jacobi_residual_sweep)
+    double sweep(cl::CommandQueue& queue,
+                 DeviceOperator& A,
+                 const cl::Buffer& b,
+                 const cl::Buffer& x,
+                 cl::Buffer& x_next,
+                 Norm norm);
+
+  private:
+    // Pass 2 over the partials and the blocking read back
+    double finish(cl::CommandQueue& queue, Norm norm);
+
+    std::size_t scalar_size_;
+    std::size_t local_;
+    int groups_;
+    cl::Kernel finalize_;
+    BufferLease partial_max_;
+    BufferLease partial_sq_;
+    BufferLease norms_;
+};
+
+/************************************************************************
+ * Solver Result														*
+ ************************************************************************/
+
+struct SolveResult
+{
+    int iterations = 0;
+    double residual = 0.0;
+    bool converged = false;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_OPERATOR_H
@@ -0,0 +1,168 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Asynchronous Chunk Pipeline
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_pipeline.h"
+#include "cl_profiler.h"
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace clp
+{
+namespace
+{
+
+// Runs on the OpenCL runtime's thread; owns the promise it is handed
+void CL_CALLBACK complete_promise(cl_event, cl_int status, void* user_data)
+{
+    std::unique_ptr<std::promise<void>> promise(static_cast<std::promise<void>*>(user_data));
+    if (status < 0)
+    {
+        promise->set_exception(std::make_exception_ptr(
+            std::runtime_error("OpenCL command failed with status " + std::to_string(status))));
+    }
+    else
+    {
+        promise->set_value();
+    }
+}
+
+}  // namespace
+
+std::future<void> when_complete(const cl::Event& event)
+{
+    std::unique_ptr<std::promise<void>> promise(new std::promise<void>());
+    std::future<void> future = promise->get_future();
+    cl::Event handle = event;
+    handle.setCallback(CL_COMPLETE, complete_promise, promise.get());
+    promise.release();
+    return future;
+}
+
+/************************************************************************
+ * Pipeline																*
+ ************************************************************************/
+
+Pipeline::Pipeline(std::size_t in_bytes, std::size_t out_bytes, ChunkKernel kernel, PipelineOptions options)
+    : in_bytes_(in_bytes), out_bytes_(out_bytes), kernel_(std::move(kernel)), out_of_order_(false), submitted_(0)
+{
+    if (options.depth < 1 || in_bytes_ == 0 || out_bytes_ == 0)
+    {
+        throw std::invalid_argument("Pipeline: need depth >= 1 and non-empty chunks");
+    }
+    Runtime& runtime = Runtime::instance();
+    const cl::Device& device = runtime.device();
+
+    // [A]:One out-of-order queue serves all three stages; without one,
+    // 	each stage gets its own in-order queue so they can still overlap
+    const cl_command_queue_properties supported = device.getInfo<CL_DEVICE_QUEUE_ON_HOST_PROPERTIES>();
+    if (options.out_of_order && (supported & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE))
+    {
+        out_of_order_ = true;
+        const cl_command_queue_properties properties = CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CLP_QUEUE_PROFILING;
+        queues_.assign(3, cl::CommandQueue(runtime.context(), device, properties));
+    }
+    else
+    {
+        for (int stage = 0; stage < 3; stage++)
+        {
+            queues_.emplace_back(runtime.context(), device, CLP_QUEUE_PROFILING);
+        }  // end stage
+    }
+
+    // [B]:Buffers of every slot
+    BufferPool& pool = BufferPool::instance();
+    slots_.resize(options.depth);
+    for (Slot& slot : slots_)
+    {
+        slot.in = pool.acquire(in_bytes_, CL_MEM_READ_ONLY);
+        slot.out = pool.acquire(out_bytes_, CL_MEM_READ_WRITE);
+    }  // end slot
+}
+
+Pipeline::~Pipeline()
+{
+    try
+    {
+        finish();
+    }
+    catch (const cl::Error&)
+    {
+        // Nothing left to report to; the buffers go back to the pool
+    }
+}
+
+std::future<void> Pipeline::submit(const void* in, void* out)
+{
+    return submit(in, in_bytes_, out, out_bytes_);
+}
+
+std::future<void> Pipeline::submit(const void* in, std::size_t in_bytes, void* out, std::size_t out_bytes)
+{
+    if (in_bytes == 0 || out_bytes == 0)
+    {
+        // A zero-byte read or write is CL_INVALID_VALUE; the caller skips
+        // 	an empty chunk instead
+        throw std::invalid_argument("Pipeline: empty chunk");
+    }
+    if (in_bytes > in_bytes_ || out_bytes > out_bytes_)
+    {
+        throw std::invalid_argument("Pipeline: chunk larger than the pipeline was built for");
+    }
+    const std::size_t chunk = submitted_++;
+    Slot& slot = slots_[chunk % slots_.size()];
+    cl::CommandQueue& upload = queues_[0];
+    cl::CommandQueue& compute = queues_[1];
+    cl::CommandQueue& download = queues_[2];
+
+    // [A]:Upload once the slot's previous kernel is done reading "in"
+    std::vector<cl::Event> wait;
+    if (slot.computed())
+    {
+        wait.push_back(slot.computed);
+    }
+    cl::Event uploaded;
+    upload.enqueueWriteBuffer(
+        slot.in.buffer(), CL_FALSE, 0, in_bytes, in, &wait, CLP_TRACE("pipeline upload", &uploaded));
+
+    // [B]:Compute once uploaded and the slot's previous result is home
+    wait.assign(1, uploaded);
+    if (slot.downloaded())
+    {
+        wait.push_back(slot.downloaded);
+    }
+    slot.computed = cl::Event();
+    kernel_(compute, chunk, slot.in.buffer(), slot.out.buffer(), wait, slot.computed);
+    if (!slot.computed())
+    {
+        throw std::logic_error("Pipeline: the chunk kernel did not set its completion event");
+    }
+
+    // [C]:Download
+    wait.assign(1, slot.computed);
+    download.enqueueReadBuffer(
+        slot.out.buffer(), CL_FALSE, 0, out_bytes, out, &wait, CLP_TRACE("pipeline download", &slot.downloaded));
+
+    // Submit now; nothing here waits on the host
+    upload.flush();
+    if (!out_of_order_)
+    {
+        compute.flush();
+        download.flush();
+    }
+    return when_complete(slot.downloaded);
+}
+
+void Pipeline::finish()
+{
+    for (cl::CommandQueue& queue : queues_)
+    {
+        queue.finish();
+    }  // end queue
+}
+
+}  // namespace clp
@@ -0,0 +1,106 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Asynchronous Chunk Pipeline
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Streams independent chunks through upload -> kernel -> download		*
+ * 	without blocking the host. Every command is non-blocking and		*
+ * 	ordered only by explicit cl::Event dependencies, and each of the	*
+ * 	"depth" slots owns its own device buffers, so with depth 2 (double	*
+ * 	buffering) chunk k+1 uploads while chunk k computes and chunk k-1	*
+ * 	downloads.															*
+ *																		*
+ * 	The stages run on one out-of-order queue							*
+ * 	(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) when the device offers		*
+ * 	one, otherwise on three in-order queues (upload, compute,			*
+ * 	download). submit() returns a std::future that becomes ready once	*
+ * 	the chunk's result is back in host memory.							*
+ ************************************************************************/
+
+#ifndef CXX_CL_PIPELINE_H
+#define CXX_CL_PIPELINE_H
+
+#include "cl_buffer_pool.h"
+#include "cl_runtime.h"
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <vector>
+
+namespace clp
+{
+
+// Future that becomes ready when "event" completes, or holds a
+// 	std::runtime_error if the command failed. Flush the event's queue
+// 	first, or it may never be submitted
+std::future<void> when_complete(const cl::Event& event);
+
+struct PipelineOptions
+{
+    int depth = 2;             // Chunks in flight, each with its own buffers
+    bool out_of_order = true;  // Prefer one out-of-order queue to three
+};
+
+// Enqueues the compute for one chunk on "queue": it must wait for "wait",
+// 	may only read "in" and write "out", and must set "done" to the event
+// 	of its last command
+using ChunkKernel = std::function<void(cl::CommandQueue& queue,
+                                       std::size_t chunk,
+                                       const cl::Buffer& in,
+                                       cl::Buffer& out,
+                                       const std::vector<cl::Event>& wait,
+                                       cl::Event& done)>;
+
+class Pipeline
+{
+  public:
+    // Chunks carry at most "in_bytes" in and "out_bytes" out
+    Pipeline(std::size_t in_bytes,
+             std::size_t out_bytes,
+             ChunkKernel kernel,
+             PipelineOptions options = PipelineOptions());
+
+    // Waits for every chunk still in flight
+    ~Pipeline();
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    // Enqueues one full chunk and returns at once; "in" and "out" must stay
+    // 	valid until the future is ready
+    std::future<void> submit(const void* in, void* out);
+
+    // Same for a partial chunk (e.g. the last one); both sizes must be
+    // 	non-zero, or std::invalid_argument is thrown
+    std::future<void> submit(const void* in, std::size_t in_bytes, void* out, std::size_t out_bytes);
+
+    // Blocks until every submitted chunk is back on the host
+    void finish();
+
+    bool out_of_order() const { return out_of_order_; }
+    int depth() const { return static_cast<int>(slots_.size()); }
+    std::size_t submitted() const { return submitted_; }
+
+  private:
+    // Device buffers of one chunk in flight, and the events that free them
+    struct Slot
+    {
+        BufferLease in;
+        BufferLease out;
+        cl::Event computed;    // Last kernel that read "in"
+        cl::Event downloaded;  // Last read of "out"
+    };
+
+    std::size_t in_bytes_;
+    std::size_t out_bytes_;
+    ChunkKernel kernel_;
+    bool out_of_order_;
+    std::vector<cl::CommandQueue> queues_;  // upload, compute, download
+    std::vector<Slot> slots_;
+    std::size_t submitted_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_PIPELINE_H
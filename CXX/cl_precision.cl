@@ -0,0 +1,32 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Mixed-Precision Refinement Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* The fp64 half of mixed-precision iterative refinement (see			*
+* 	cl_precision.h): the residual is formed in double and rounded to	*
+* 	float for the inner solve, and the float correction is added to		*
+* 	the double iterate. One work-item per element.						*
+************************************************************************/
+
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+
+// r = (float)(b - Ax)
+__kernel void cl_refine_residual(int n, const __global double *b, const __global double *Ax,
+								__global float *r){
+	int gid = get_global_id(0);
+	if (gid < n){
+		r[gid] = (float)(b[gid] - Ax[gid]);
+	}/*end if*/
+}
+
+
+
+// x += d
+__kernel void cl_refine_update(int n, const __global float *d, __global double *x){
+	int gid = get_global_id(0);
+	if (gid < n){
+		x[gid] += (double)d[gid];
+	}/*end if*/
+}
@@ -0,0 +1,162 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Precision Selection and Mixed-Precision Refinement
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_precision.h"
+#include "cl_buffer_pool.h"
+#include "cl_profiler.h"
+#include <algorithm>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace clp
+{
+
+/************************************************************************
+ * Precision Selection													*
+ ************************************************************************/
+
+const char* precision_name(Precision precision)
+{
+    switch (precision)
+    {
+        case Precision::Single:
+            return "single";
+        case Precision::Mixed:
+            return "mixed";
+        default:
+            return "double";
+    }
+}
+
+Precision parse_precision(const std::string& name)
+{
+    if (name == "double" || name == "fp64")
+    {
+        return Precision::Double;
+    }
+    if (name == "single" || name == "fp32")
+    {
+        return Precision::Single;
+    }
+    if (name == "mixed")
+    {
+        return Precision::Mixed;
+    }
+    throw std::invalid_argument("unknown precision '" + name + "', expected double, single or mixed");
+}
+
+bool fp64_supported(const cl::Device& device)
+{
+    return device.getInfo<CL_DEVICE_EXTENSIONS>().find("cl_khr_fp64") != std::string::npos;
+}
+
+Precision default_precision()
+{
+    const char* value = getenv("CLP_PRECISION");
+    if (value && *value)
+    {
+        return parse_precision(value);
+    }
+    return fp64_supported(Runtime::instance().device()) ? Precision::Double : Precision::Single;
+}
+
+/************************************************************************
+ * Iterative Refinement													*
+ ************************************************************************/
+
+RefinementSolver::RefinementSolver(RefinementOptions options) : options_(options)
+{
+    if (!fp64_supported(Runtime::instance().device()))
+    {
+        throw std::runtime_error("RefinementSolver: the device has no cl_khr_fp64 for the residual");
+    }
+    options_.max_refinements = std::max(1, options_.max_refinements);
+
+    cl::Program program = build_program(load_kernel_source("cl_precision.cl"));
+    residual_ = cl::Kernel(program, "cl_refine_residual");
+    update_ = cl::Kernel(program, "cl_refine_update");
+}
+
+RefinementResult RefinementSolver::solve(cl::CommandQueue& queue,
+                                         DeviceOperator& A,
+                                         DeviceOperator& A_single,
+                                         const cl::Buffer& b,
+                                         cl::Buffer& x)
+{
+    if (A.scalar_size() != sizeof(double) || A_single.scalar_size() != sizeof(float))
+    {
+        throw std::invalid_argument("RefinementSolver: needs a <double> and a <float> operator");
+    }
+    if (A.rows() != A_single.rows())
+    {
+        throw std::invalid_argument("RefinementSolver: the two operators differ in size");
+    }
+    const int n = A.rows();
+    const cl::NDRange global(n);
+    RefinementResult result;
+    ResidualNorms residual(A);
+
+    // [A]:fp64 A*x, and the fp32 residual and correction of the inner solve
+    BufferPool& pool = BufferPool::instance();
+    BufferLease Ax = pool.acquire(sizeof(double) * n);
+    BufferLease r = pool.acquire(sizeof(float) * n);
+    BufferLease d = pool.acquire(sizeof(float) * n);
+    residual_.setArg(0, n);
+    residual_.setArg(1, b);
+    residual_.setArg(2, Ax.buffer());
+    residual_.setArg(3, r.buffer());
+    update_.setArg(0, n);
+    update_.setArg(1, d.buffer());
+    update_.setArg(2, x);
+
+    // The fp32 inner solver and its norms serve every pass; only the
+    // 	tolerance changes
+    JacobiOptions inner = options_.inner;
+    inner.norm = options_.norm;
+    JacobiSolver inner_solver(inner);
+    ResidualNorms inner_residual(A_single);
+
+    double res = residual(queue, A, b, x, options_.norm);
+    if (options_.verbose)
+    {
+        printf("refinement = 0 | %s Residual = %e\n", norm_name(options_.norm), res);
+    }
+
+    while (res > options_.tol && result.refinements < options_.max_refinements)
+    {
+        result.refinements += 1;
+
+        // [B]:r = b - Ax in fp64, rounded to fp32
+        A.apply(queue, x, Ax.buffer());
+        queue.enqueueNDRangeKernel(
+            residual_, cl::NullRange, global, cl::NullRange, nullptr, CLP_TRACE("cl_refine_residual", nullptr));
+
+        // [C]:A d = r in fp32 from d = 0, to a fraction of the current residual
+        inner_solver.set_tol(res * options_.inner_reduction);
+        queue.enqueueFillBuffer(d.buffer(), 0.0f, 0, sizeof(float) * n);
+        const SolveResult step = inner_solver.solve(queue, A_single, r.buffer(), d.buffer(), inner_residual);
+        result.iterations += step.iterations;
+
+        // [D]:x += d in fp64, then the true fp64 residual
+        queue.enqueueNDRangeKernel(
+            update_, cl::NullRange, global, cl::NullRange, nullptr, CLP_TRACE("cl_refine_update", nullptr));
+        res = residual(queue, A, b, x, options_.norm);
+        if (options_.verbose)
+        {
+            printf("refinement = %d | %d inner sweeps | %s Residual = %e\n",
+                   result.refinements,
+                   step.iterations,
+                   norm_name(options_.norm),
+                   res);
+        }
+    }  // end while
+
+    result.residual = res;
+    result.converged = res <= options_.tol;
+    return result;
+}
+
+}  // namespace clp
@@ -0,0 +1,96 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Precision Selection and Mixed-Precision Refinement
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Runtime choice of the scalar the Jacobi path works in. The operators	*
+ * 	(cl_operator.h, cl_sparse.h) are templated on float or double and	*
+ * 	build their REAL-templated kernels to match:						*
+ * 		double	everything in fp64 (needs cl_khr_fp64)					*
+ * 		single	everything in fp32: half the bytes per sweep, and		*
+ * 				runs on devices without fp64							*
+ * 		mixed	iterative refinement: the inner Jacobi solves run in	*
+ * 				fp32, the residual b - Ax and the correction x += d		*
+ * 				in fp64 (cl_precision.cl), so the answer reaches fp64	*
+ * 				accuracy while the sweeps move fp32 data				*
+ *																		*
+ * 	The default comes from CLP_PRECISION (double, single or mixed),		*
+ * 	else double where the device has cl_khr_fp64 and single elsewhere.	*
+ ************************************************************************/
+
+#ifndef CXX_CL_PRECISION_H
+#define CXX_CL_PRECISION_H
+
+#include "cl_jacobi_solver.h"
+#include "cl_operator.h"
+#include "cl_runtime.h"
+#include <string>
+
+namespace clp
+{
+
+enum class Precision
+{
+    Double = 0,
+    Single = 1,
+    Mixed = 2
+};
+
+const char* precision_name(Precision precision);
+
+// "double", "single" or "mixed" (also "fp64", "fp32"); throws
+// 	std::invalid_argument for anything else
+Precision parse_precision(const std::string& name);
+
+// True when the device can build the fp64 kernels
+bool fp64_supported(const cl::Device& device);
+
+// Precision used for the runtime's device unless told otherwise
+Precision default_precision();
+
+/************************************************************************
+ * Iterative Refinement													*
+ ************************************************************************/
+
+struct RefinementOptions
+{
+    double tol = 1e-10;             // Target fp64 residual
+    int max_refinements = 30;       // fp64 corrections
+    double inner_reduction = 1e-3;  // Each inner solve cuts the residual by this factor
+    Norm norm = Norm::Inf;          // ||b - Ax||_inf or ||b - Ax||_2
+    bool verbose = true;            // Print the residual after every correction
+    JacobiOptions inner;            // fp32 inner solves; tol and norm are set per step
+};
+
+struct RefinementResult : SolveResult
+{
+    int refinements = 0;  // Outer fp64 corrections; "iterations" counts inner sweeps
+};
+
+class RefinementSolver
+{
+  public:
+    explicit RefinementSolver(RefinementOptions options = RefinementOptions());
+
+    // Solves A x = b in fp64. "A" is the <double> operator and "A_single"
+    // 	the same matrix as a <float> one; b and x are double vectors, x
+    // 	holds the initial guess and receives the solution. Throws
+    // 	std::runtime_error on a device without cl_khr_fp64
+    RefinementResult solve(cl::CommandQueue& queue,
+                           DeviceOperator& A,
+                           DeviceOperator& A_single,
+                           const cl::Buffer& b,
+                           cl::Buffer& x);
+
+    const RefinementOptions& options() const { return options_; }
+
+  private:
+    RefinementOptions options_;
+    cl::Kernel residual_;
+    cl::Kernel update_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_PRECISION_H
@@ -0,0 +1,276 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Command Profiler
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_profiler.h"
+
+#ifdef CLP_PROFILE
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <stdlib.h>
+
+namespace clp
+{
+namespace
+{
+
+// Pending events are scanned for finished ones this often, so long runs
+// 	do not hold every event until exit
+const std::size_t kResolveEvery = 4096;
+
+// Execution time histogram: bucket b holds [2^b, 2^(b+1)) microseconds,
+// 	bucket 0 also everything below 1 us
+const int kBuckets = 24;
+
+const char* category(cl_command_type type)
+{
+    switch (type)
+    {
+        case CL_COMMAND_NDRANGE_KERNEL:
+        case CL_COMMAND_TASK:
+            return "kernel";
+        case CL_COMMAND_READ_BUFFER:
+        case CL_COMMAND_WRITE_BUFFER:
+        case CL_COMMAND_COPY_BUFFER:
+        case CL_COMMAND_READ_BUFFER_RECT:
+        case CL_COMMAND_WRITE_BUFFER_RECT:
+        case CL_COMMAND_FILL_BUFFER:
+        case CL_COMMAND_MAP_BUFFER:
+        case CL_COMMAND_UNMAP_MEM_OBJECT:
+        case CL_COMMAND_SVM_MAP:
+        case CL_COMMAND_SVM_UNMAP:
+            return "transfer";
+        default:
+            return "other";
+    }
+}
+
+int bucket(cl_ulong ns)
+{
+    int b = 0;
+    for (cl_ulong us = ns / 1000; us > 1 && b < kBuckets - 1; us /= 2)
+    {
+        b++;
+    }  // end us
+    return b;
+}
+
+std::string json_escape(const std::string& s)
+{
+    std::string escaped;
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }  // end c
+    return escaped;
+}
+
+struct Summary
+{
+    std::size_t count = 0;
+    double total_us = 0.0;
+    double min_us = 0.0;
+    double max_us = 0.0;
+    double queued_us = 0.0;  // QUEUED -> SUBMIT, summed
+    double submit_us = 0.0;  // SUBMIT -> START, summed
+    std::vector<std::size_t> histogram = std::vector<std::size_t>(kBuckets, 0);
+};
+
+}  // namespace
+
+/************************************************************************
+ * Profiler																*
+ ************************************************************************/
+
+Profiler& Profiler::instance()
+{
+    // Created on first use, i.e. after the runtime, so it is destroyed (and
+    // 	reports) while the OpenCL objects are still alive
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::~Profiler()
+{
+    try
+    {
+        if (samples().empty())
+        {
+            return;
+        }
+        print_summary(stderr);
+        const char* path = getenv("CLP_TRACE_FILE");
+        write_chrome_trace(path && *path ? path : "clp_trace.json");
+    }
+    catch (const std::exception& e)
+    {
+        fprintf(stderr, "Profiler: %s\n", e.what());
+    }
+}
+
+void Profiler::record(std::string name, const cl::Event& event)
+{
+    if (!event())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.emplace_back(std::move(name), event);
+    if (pending_.size() % kResolveEvery == 0)
+    {
+        resolve(false);
+    }
+}
+
+void Profiler::resolve(bool wait)
+{
+    std::vector<std::pair<std::string, cl::Event>> still_pending;
+    for (auto& entry : pending_)
+    {
+        cl::Event& event = entry.second;
+        if (wait)
+        {
+            event.wait();
+        }
+        else if (event.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>() != CL_COMPLETE)
+        {
+            still_pending.push_back(std::move(entry));
+            continue;
+        }
+
+        // A queue created without profiling (by the caller) has no timestamps
+        ProfileSample sample;
+        try
+        {
+            sample.queued = event.getProfilingInfo<CL_PROFILING_COMMAND_QUEUED>();
+            sample.submit = event.getProfilingInfo<CL_PROFILING_COMMAND_SUBMIT>();
+            sample.start = event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+            sample.end = event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+        }
+        catch (const cl::Error&)
+        {
+            continue;
+        }
+        sample.name = std::move(entry.first);
+        sample.type = event.getInfo<CL_EVENT_COMMAND_TYPE>();
+        const cl_command_queue queue = event.getInfo<CL_EVENT_COMMAND_QUEUE>()();
+        sample.queue = queue_ids_.emplace(queue, static_cast<int>(queue_ids_.size())).first->second;
+        samples_.push_back(std::move(sample));
+    }  // end entry
+    pending_.swap(still_pending);
+}
+
+std::vector<ProfileSample> Profiler::samples()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    resolve(true);
+    return samples_;
+}
+
+void Profiler::print_summary(std::FILE* out)
+{
+    // [A]:Aggregate per command name
+    const std::vector<ProfileSample> all = samples();
+    std::map<std::string, Summary> by_name;
+    std::map<std::string, double> by_category;
+    for (const ProfileSample& s : all)
+    {
+        Summary& summary = by_name[s.name];
+        const double us = (s.end - s.start) * 1e-3;
+        summary.min_us = summary.count == 0 ? us : std::min(summary.min_us, us);
+        summary.max_us = std::max(summary.max_us, us);
+        summary.count++;
+        summary.total_us += us;
+        summary.queued_us += (s.submit - s.queued) * 1e-3;
+        summary.submit_us += (s.start - s.submit) * 1e-3;
+        summary.histogram[bucket(s.end - s.start)]++;
+        by_category[category(s.type)] += us;
+    }  // end s
+
+    // [B]:One line per name, its histogram underneath
+    fprintf(out, "\nProfile: %zu commands\n", all.size());
+    fprintf(out,
+            "%-28s %8s %12s %10s %10s %10s %12s %12s\n",
+            "command",
+            "count",
+            "total ms",
+            "mean us",
+            "min us",
+            "max us",
+            "queued us",
+            "submit us");
+    for (const auto& entry : by_name)
+    {
+        const Summary& s = entry.second;
+        fprintf(out,
+                "%-28s %8zu %12.3f %10.2f %10.2f %10.2f %12.2f %12.2f\n",
+                entry.first.c_str(),
+                s.count,
+                s.total_us * 1e-3,
+                s.total_us / s.count,
+                s.min_us,
+                s.max_us,
+                s.queued_us / s.count,
+                s.submit_us / s.count);
+        fprintf(out, "%-28s", "");
+        for (int b = 0; b < kBuckets; b++)
+        {
+            if (s.histogram[b])
+            {
+                fprintf(out, " %luus:%zu", 1ul << b, s.histogram[b]);
+            }
+        }  // end b
+        fprintf(out, "\n");
+    }  // end entry
+    for (const auto& entry : by_category)
+    {
+        fprintf(out, "Total %-8s : %12.3f ms\n", entry.first.c_str(), entry.second * 1e-3);
+    }  // end entry
+}
+
+void Profiler::write_chrome_trace(const std::string& path)
+{
+    const std::vector<ProfileSample> all = samples();
+    std::ofstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("cannot write trace file '" + path + "'");
+    }
+
+    // Timestamps relative to the first command, in microseconds
+    cl_ulong origin = all.empty() ? 0 : all.front().queued;
+    int queues = 0;
+    for (const ProfileSample& s : all)
+    {
+        origin = std::min(origin, s.queued);
+        queues = std::max(queues, s.queue + 1);
+    }  // end s
+
+    file << "{\"traceEvents\":[\n";
+    for (int q = 0; q < queues; q++)
+    {
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << q
+             << ",\"args\":{\"name\":\"queue " << q << "\"}},\n";
+    }  // end q
+    for (std::size_t i = 0; i < all.size(); i++)
+    {
+        const ProfileSample& s = all[i];
+        file << "{\"name\":\"" << json_escape(s.name) << "\",\"cat\":\"" << category(s.type)
+             << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << s.queue << ",\"ts\":" << (s.start - origin) * 1e-3
+             << ",\"dur\":" << (s.end - s.start) * 1e-3 << ",\"args\":{\"queued_us\":" << (s.submit - s.queued) * 1e-3
+             << ",\"submit_us\":" << (s.start - s.submit) * 1e-3 << "}}" << (i + 1 < all.size() ? ",\n" : "\n");
+    }  // end i
+    file << "]}\n";
+    fprintf(stderr, "Chrome trace written to %s\n", path.c_str());
+}
+
+}  // namespace clp
+
+#endif  // CLP_PROFILE
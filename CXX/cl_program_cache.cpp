@@ -0,0 +1,255 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Program Binary Cache
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_program_cache.h"
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace clp
+{
+namespace
+{
+
+const char* kMagic = "CLP_PROGRAM_CACHE 1";
+
+std::string hex64(std::uint64_t value)
+{
+    char buffer[17];
+    snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+std::string default_directory()
+{
+    const char* disabled = getenv("CLP_PROGRAM_CACHE");
+    if (disabled && (std::string(disabled) == "0" || std::string(disabled) == "off"))
+    {
+        return "";
+    }
+
+    const char* dir = getenv("CLP_PROGRAM_CACHE_DIR");
+    if (dir && *dir)
+    {
+        return dir;
+    }
+    const char* xdg = getenv("XDG_CACHE_HOME");
+    if (xdg && *xdg)
+    {
+        return std::string(xdg) + "/opencl_playground";
+    }
+    const char* home = getenv("HOME");
+    if (home && *home)
+    {
+        return std::string(home) + "/.cache/opencl_playground";
+    }
+    return "";
+}
+
+// Compiles from source, printing the build log for every device on failure
+cl::Program compile(const cl::Context& context,
+                    const std::vector<cl::Device>& devices,
+                    const std::string& source,
+                    const std::string& options)
+{
+    cl::Program program(context, source);
+    try
+    {
+        program.build(devices, options.c_str());
+    }
+    catch (const cl::Error&)
+    {
+        // Print build info for all devices
+        cl_int build_err = CL_SUCCESS;
+        auto build_info = program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(&build_err);
+        for (auto& pair : build_info)
+        {
+            std::cerr << pair.second << std::endl << std::endl;
+        }
+        throw;
+    }
+    return program;
+}
+
+}  // namespace
+
+std::uint64_t fnv1a_64(const std::string& data)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : data)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/************************************************************************
+ * Program Cache														*
+ ************************************************************************/
+
+ProgramCache::ProgramCache(std::string directory) : directory_(std::move(directory)) {}
+
+ProgramCache& ProgramCache::instance()
+{
+    static ProgramCache cache(default_directory());
+    return cache;
+}
+
+std::string ProgramCache::key(const cl::Device& device, const std::string& source, const std::string& options)
+{
+    cl::Platform platform(device.getInfo<CL_DEVICE_PLATFORM>());
+
+    std::ostringstream key;
+    key << "source=" << hex64(fnv1a_64(source)) << ":" << source.size()
+        << ";platform=" << platform.getInfo<CL_PLATFORM_VERSION>() << ";device=" << device.getInfo<CL_DEVICE_NAME>()
+        << ";device_version=" << device.getInfo<CL_DEVICE_VERSION>()
+        << ";driver=" << device.getInfo<CL_DRIVER_VERSION>() << ";options=" << options;
+    return key.str();
+}
+
+std::string ProgramCache::entry_path(const std::string& key) const
+{
+    return directory_ + "/" + hex64(fnv1a_64(key)) + ".clbin";
+}
+
+bool ProgramCache::load(const std::string& key, std::vector<unsigned char>& binary) const
+{
+    std::ifstream file(entry_path(key), std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    // Layout: magic line, key line, size line, raw binary
+    std::string magic, stored_key, size_line;
+    if (!std::getline(file, magic) || magic != kMagic || !std::getline(file, stored_key) || stored_key != key ||
+        !std::getline(file, size_line))
+    {
+        return false;
+    }
+
+    // A truncated or edited entry is a miss, never an error: the size must
+    // 	parse whole and match the bytes left in the file
+    unsigned long long size = 0;
+    const char* first = size_line.data();
+    const char* last = first + size_line.size();
+    const std::from_chars_result parsed = std::from_chars(first, last, size);
+    if (parsed.ec != std::errc() || parsed.ptr != last || size == 0)
+    {
+        return false;
+    }
+    const std::streampos start = file.tellg();
+    file.seekg(0, std::ios::end);
+    const std::streampos end = file.tellg();
+    if (start < 0 || end < 0 || static_cast<unsigned long long>(end - start) != size)
+    {
+        return false;
+    }
+    file.seekg(start);
+
+    binary.resize(size);
+    file.read(reinterpret_cast<char*>(binary.data()), size);
+    return static_cast<std::size_t>(file.gcount()) == size;
+}
+
+void ProgramCache::store(const std::string& key, const std::vector<unsigned char>& binary) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec)
+    {
+        return;
+    }
+
+    // Write to a private temporary and rename so concurrent processes
+    // 	never observe a half written entry
+    const std::string path = entry_path(key);
+    const std::string tmp = path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return;
+        }
+        file << kMagic << "\n" << key << "\n" << binary.size() << "\n";
+        file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+        if (!file)
+        {
+            file.close();
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tmp, ec);
+    }
+}
+
+cl::Program ProgramCache::build(const cl::Context& context,
+                                const std::vector<cl::Device>& devices,
+                                const std::string& source,
+                                const std::string& options)
+{
+    if (!enabled())
+    {
+        return compile(context, devices, source, options);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // [A]:Warm start, every device must hit
+    std::vector<std::string> keys;
+    cl::Binaries binaries;
+    for (const cl::Device& device : devices)
+    {
+        keys.push_back(key(device, source, options));
+        std::vector<unsigned char> binary;
+        if (load(keys.back(), binary))
+        {
+            binaries.push_back(std::move(binary));
+        }
+    }  // end device
+
+    if (binaries.size() == devices.size())
+    {
+        try
+        {
+            std::vector<cl_int> status;
+            cl::Program program(context, devices, binaries, &status);
+            program.build(devices, options.c_str());
+            return program;
+        }
+        catch (const cl::Error&)
+        {
+            // Rejected binary (e.g. CL_INVALID_BINARY after a driver update
+            // 	that kept its version string): fall through and recompile
+        }
+    }
+
+    // [B]:Cold start, compile and store one binary per device
+    cl::Program program = compile(context, devices, source, options);
+
+    std::vector<cl::Device> program_devices = program.getInfo<CL_PROGRAM_DEVICES>();
+    cl::Binaries built = program.getInfo<CL_PROGRAM_BINARIES>();
+    for (std::size_t i = 0; i < program_devices.size() && i < built.size(); i++)
+    {
+        if (!built[i].empty())
+        {
+            store(key(program_devices[i], source, options), built[i]);
+        }
+    }  // end i
+
+    return program;
+}
+
+}  // namespace clp
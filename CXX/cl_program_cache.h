@@ -0,0 +1,73 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Program Binary Cache
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * On-disk cache of CL_PROGRAM_BINARIES. JIT compiling a program on the	*
+ * 	POCL/Intel CPU runtimes costs hundreds of ms per start, so built	*
+ * 	binaries are stored per device and reloaded with					*
+ * 	clCreateProgramWithBinary on warm starts.							*
+ *																		*
+ * 	Every entry is keyed by the kernel source hash, platform version,	*
+ * 	device name/version, driver version and build options. The full key	*
+ * 	is stored in the entry and compared on load, so a changed source,	*
+ * 	driver or option set always misses and is recompiled.				*
+ *																		*
+ * 	CLP_PROGRAM_CACHE_DIR  cache directory (default						*
+ * 						   $XDG_CACHE_HOME/opencl_playground or			*
+ * 						   $HOME/.cache/opencl_playground)				*
+ * 	CLP_PROGRAM_CACHE	   set to 0/off to always compile from source	*
+ ************************************************************************/
+
+#ifndef CXX_CL_PROGRAM_CACHE_H
+#define CXX_CL_PROGRAM_CACHE_H
+
+#include "cl_runtime.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace clp
+{
+
+class ProgramCache
+{
+  public:
+    // An empty directory disables the cache
+    explicit ProgramCache(std::string directory);
+
+    // Process-wide cache configured from the environment
+    static ProgramCache& instance();
+
+    // Returns a program built for every device in "devices". A warm hit
+    // 	loads the stored binaries; a miss (or a binary the driver rejects)
+    // 	compiles from source and stores the result. On a compile error the
+    // 	build log is written to stderr and the cl::Error is rethrown
+    cl::Program build(const cl::Context& context,
+                      const std::vector<cl::Device>& devices,
+                      const std::string& source,
+                      const std::string& options);
+
+    bool enabled() const { return !directory_.empty(); }
+    const std::string& directory() const { return directory_; }
+
+    // Full key describing one (source, device, driver, options) tuple
+    static std::string key(const cl::Device& device, const std::string& source, const std::string& options);
+
+  private:
+    std::string entry_path(const std::string& key) const;
+    bool load(const std::string& key, std::vector<unsigned char>& binary) const;
+    void store(const std::string& key, const std::vector<unsigned char>& binary) const;
+
+    std::string directory_;
+    mutable std::mutex mutex_;
+};
+
+// 64-bit FNV-1a, used for source hashes and entry file names
+std::uint64_t fnv1a_64(const std::string& data);
+
+}  // namespace clp
+
+#endif  // CXX_CL_PROGRAM_CACHE_H
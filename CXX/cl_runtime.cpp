@@ -0,0 +1,295 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: OpenCL Runtime
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_runtime.h"
+#include "cl_profiler.h"
+#include "cl_program_cache.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+
+namespace clp
+{
+namespace
+{
+
+/************************************************************************
+ * Environment Helpers													*
+ ************************************************************************/
+
+std::string env_or_empty(const char* name)
+{
+    const char* value = getenv(name);
+    return value ? std::string(value) : std::string();
+}
+
+std::string lower(std::string s)
+{
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return std::tolower(c); });
+    return s;
+}
+
+bool is_index(const std::string& s)
+{
+    return !s.empty() && std::all_of(s.begin(), s.end(), [](unsigned char c) { return std::isdigit(c); });
+}
+
+// Picks an entry by index or by case-insensitive name substring. An empty
+// 	selector picks the first entry
+template <typename T, typename NameFn>
+int select_entry(const std::vector<T>& entries, const std::string& selector, NameFn name_of)
+{
+    if (selector.empty())
+    {
+        return entries.empty() ? -1 : 0;
+    }
+    if (is_index(selector))
+    {
+        std::size_t index = std::stoul(selector);
+        return index < entries.size() ? static_cast<int>(index) : -1;
+    }
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        if (lower(name_of(entries[i])).find(lower(selector)) != std::string::npos)
+        {
+            return static_cast<int>(i);
+        }
+    }  // end i
+    return -1;
+}
+
+cl_device_type parse_device_type(const std::string& type)
+{
+    std::string t = lower(type);
+    if (t.empty() || t == "all")
+    {
+        return CL_DEVICE_TYPE_ALL;
+    }
+    if (t == "cpu")
+    {
+        return CL_DEVICE_TYPE_CPU;
+    }
+    if (t == "gpu")
+    {
+        return CL_DEVICE_TYPE_GPU;
+    }
+    if (t == "accelerator")
+    {
+        return CL_DEVICE_TYPE_ACCELERATOR;
+    }
+    throw std::runtime_error("CLP_DEVICE_TYPE must be one of cpu, gpu, accelerator, all (got '" + type + "')");
+}
+
+}  // namespace
+
+/************************************************************************
+ * Runtime																*
+ ************************************************************************/
+
+Runtime& Runtime::instance()
+{
+    // Function-local static: initialized once, on first use, thread-safe
+    static Runtime runtime;
+    return runtime;
+}
+
+Runtime::Runtime()
+{
+    // [A]:Platform
+    std::vector<cl::Platform> platforms;
+    try
+    {
+        cl::Platform::get(&platforms);
+    }
+    catch (const cl::Error&)
+    {
+        // No ICD installed/registered: treated the same as zero platforms
+        platforms.clear();
+    }
+    if (platforms.empty())
+    {
+        throw std::runtime_error("No OpenCL platforms found");
+    }
+
+    const std::string platform_selector = env_or_empty("CLP_PLATFORM");
+    int platform_index = select_entry(
+        platforms, platform_selector, [](const cl::Platform& p) { return p.getInfo<CL_PLATFORM_NAME>(); });
+    if (platform_index < 0)
+    {
+        throw std::runtime_error("CLP_PLATFORM='" + platform_selector + "' matches no OpenCL platform");
+    }
+    platform_ = platforms[platform_index];
+
+    // [B]:Device
+    std::vector<cl::Device> devices;
+    try
+    {
+        platform_.getDevices(selected_device_type(), &devices);
+    }
+    catch (const cl::Error&)
+    {
+        // CL_DEVICE_NOT_FOUND is reported as an exception
+        devices.clear();
+    }
+
+    const std::string device_selector = env_or_empty("CLP_DEVICE");
+    int device_index =
+        select_entry(devices, device_selector, [](const cl::Device& d) { return d.getInfo<CL_DEVICE_NAME>(); });
+    if (device_index < 0)
+    {
+        throw std::runtime_error("No OpenCL device on '" + platform_.getInfo<CL_PLATFORM_NAME>() +
+                                 "' matches CLP_DEVICE='" + device_selector + "'");
+    }
+    device_ = devices[device_index];
+
+    // [C]:Context and Queue Pool
+    context_ = cl::Context(device_);
+
+    std::size_t queue_count = 1;
+    const std::string queues = env_or_empty("CLP_QUEUES");
+    if (is_index(queues) && std::stoul(queues) > 0)
+    {
+        queue_count = std::stoul(queues);
+    }
+    for (std::size_t i = 0; i < queue_count; i++)
+    {
+        queues_.emplace_back(context_, device_, CLP_QUEUE_PROFILING);
+    }  // end i
+}
+
+cl::CommandQueue& Runtime::queue(std::size_t index)
+{
+    return queues_.at(index);
+}
+
+cl::CommandQueue& Runtime::next_queue()
+{
+    return queues_[next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size()];
+}
+
+cl::CommandQueue& Runtime::profiling_queue()
+{
+    std::call_once(profiling_once_,
+                   [this] { profiling_queue_ = cl::CommandQueue(context_, device_, CL_QUEUE_PROFILING_ENABLE); });
+    return profiling_queue_;
+}
+
+void Runtime::print_selection() const
+{
+    std::cout << "Platform Name: " << platform_.getInfo<CL_PLATFORM_NAME>() << std::endl;
+    std::cout << "Device Name: " << device_.getInfo<CL_DEVICE_NAME>() << std::endl;
+    std::cout << "Command Queues: " << queues_.size() << "\n" << std::endl;
+}
+
+/************************************************************************
+ * Kernel Source Loading												*
+ ************************************************************************/
+
+std::string load_kernel_source(const std::string& name)
+{
+    std::vector<std::string> candidates;
+    const std::string kernel_path = env_or_empty("CLP_KERNEL_PATH");
+    if (!kernel_path.empty())
+    {
+        candidates.push_back(kernel_path + "/" + name);
+    }
+    candidates.push_back(name);
+    candidates.push_back("CXX/" + name);
+
+    for (const std::string& path : candidates)
+    {
+        std::ifstream file(path);
+        if (file)
+        {
+            std::stringstream source;
+            source << file.rdbuf();
+            return source.str();
+        }
+    }  // end path
+
+    throw std::runtime_error("Failed to load kernel source '" + name + "'");
+}
+
+/************************************************************************
+ * Program Build														*
+ ************************************************************************/
+
+cl::Program build_program(const std::string& source, const std::string& options)
+{
+    // Routed through the on-disk binary cache (see cl_program_cache.h)
+    Runtime& runtime = Runtime::instance();
+    return ProgramCache::instance().build(runtime.context(), {runtime.device()}, source, options);
+}
+
+cl_device_type selected_device_type()
+{
+    return parse_device_type(env_or_empty("CLP_DEVICE_TYPE"));
+}
+
+const char* backend_name(Backend backend)
+{
+    return backend == Backend::Native ? "native" : "opencl";
+}
+
+Backend select_backend()
+{
+    const std::string name = lower(env_or_empty("CLP_BACKEND"));
+    if (name == "native")
+    {
+        return Backend::Native;
+    }
+    if (name == "opencl")
+    {
+        return Backend::OpenCL;
+    }
+    if (!name.empty() && name != "auto")
+    {
+        throw std::runtime_error("CLP_BACKEND must be one of opencl, native, auto (got '" + name + "')");
+    }
+
+    // No ICD, no platform or no matching device all end up here
+    try
+    {
+        Runtime::instance();
+        return Backend::OpenCL;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "; using the native host backend" << std::endl;
+        return Backend::Native;
+    }
+}
+
+/************************************************************************
+ * Print All Platforms Functions 										*
+ ************************************************************************/
+
+int print_platforms(const std::vector<cl::Platform>& platforms)
+{
+    for (const cl::Platform& platform : platforms)
+    {
+        auto platform_profile = platform.getInfo<CL_PLATFORM_PROFILE>();
+        auto platform_name = platform.getInfo<CL_PLATFORM_NAME>();
+        auto platform_vendor = platform.getInfo<CL_PLATFORM_VENDOR>();
+        auto platform_version = platform.getInfo<CL_PLATFORM_VERSION>();
+        auto platform_extensions = platform.getInfo<CL_PLATFORM_EXTENSIONS>();
+
+        std::cout << "\nPlatform Profile: " << platform_profile << std::endl;
+        std::cout << "Platform Name: " << platform_name << std::endl;
+        std::cout << "Platform Vendor: " << platform_vendor << std::endl;
+        std::cout << "Platform Version " << platform_version << std::endl;
+        std::cout << "Platform Extensions: " << platform_extensions << "\n" << std::endl;
+
+    }  // end platform
+
+    return 0;
+
+}  // end FUNCTION print_platforms
+
+}  // namespace clp
@@ -0,0 +1,144 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: OpenCL Runtime
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Process-wide OpenCL runtime shared by every CXX binary. The platform,	*
+ * 	device, context and a small pool of command queues are discovered	*
+ * 	once, lazily, on first use of Runtime::instance(). Device selection	*
+ * 	is driven by the following environment variables:					*
+ *																		*
+ * 	CLP_PLATFORM	 platform index or (case-insensitive) name substring	*
+ * 	CLP_DEVICE		 device index or (case-insensitive) name substring	*
+ * 	CLP_DEVICE_TYPE	 cpu | gpu | accelerator | all (default all)		*
+ * 	CLP_QUEUES		 number of queues in the pool (default 1)			*
+ * 	CLP_KERNEL_PATH	 directory searched first for .cl kernel sources	*
+ * 	CLP_BACKEND		 opencl | native | auto (default auto, see			*
+ * 					 select_backend)									*
+ ************************************************************************/
+
+#ifndef CXX_CL_RUNTIME_H
+#define CXX_CL_RUNTIME_H
+
+#ifndef CL_HPP_ENABLE_EXCEPTIONS
+#define CL_HPP_ENABLE_EXCEPTIONS
+#endif
+#ifndef CL_HPP_TARGET_OPENCL_VERSION
+#define CL_HPP_TARGET_OPENCL_VERSION 200
+#endif
+
+#include <CL/opencl.hpp>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace clp
+{
+
+/************************************************************************
+ * Runtime																*
+ ************************************************************************/
+
+class Runtime
+{
+  public:
+    // Returns the process-wide runtime, creating it on first call. Throws
+    // 	std::runtime_error when no platform/device matches the selection
+    static Runtime& instance();
+
+    Runtime(const Runtime&) = delete;
+    Runtime& operator=(const Runtime&) = delete;
+
+    const cl::Platform& platform() const { return platform_; }
+    const cl::Device& device() const { return device_; }
+    const cl::Context& context() const { return context_; }
+
+    // Queue pool: queue(i) is stable, next_queue() hands them out round-robin
+    cl::CommandQueue& queue(std::size_t index = 0);
+    cl::CommandQueue& next_queue();
+    std::size_t queue_count() const { return queues_.size(); }
+
+    // Separate queue created with CL_QUEUE_PROFILING_ENABLE on first use, for
+    // 	callers that time commands with event profiling (e.g. the auto-tuner)
+    cl::CommandQueue& profiling_queue();
+
+    // Prints the selected platform/device in the same layout the binaries
+    // 	used to print by hand
+    void print_selection() const;
+
+  private:
+    Runtime();
+
+    cl::Platform platform_;
+    cl::Device device_;
+    cl::Context context_;
+    std::vector<cl::CommandQueue> queues_;
+    std::atomic<std::size_t> next_queue_{0};
+    std::once_flag profiling_once_;
+    cl::CommandQueue profiling_queue_;
+};
+
+/************************************************************************
+ * Helpers																*
+ ************************************************************************/
+
+// Reads a kernel source file. The name is looked up in CLP_KERNEL_PATH,
+// 	the working directory and CXX/ (the bazel runfiles layout), in order
+std::string load_kernel_source(const std::string& name);
+
+// Builds a program for the runtime's device, reusing a cached binary when
+// 	one matches (see cl_program_cache.h). On failure the build log is
+// 	written to stderr and the cl::Error is rethrown
+cl::Program build_program(const std::string& source, const std::string& options = "-cl-std=CL2.0");
+
+int print_platforms(const std::vector<cl::Platform>& platforms);
+
+// Where a binary runs its kernels: the OpenCL runtime, or the threaded
+// 	host versions of host_kernels.h
+enum class Backend
+{
+    OpenCL = 0,
+    Native = 1
+};
+
+const char* backend_name(Backend backend);
+
+// Backend selected by CLP_BACKEND. "auto" (or unset) picks OpenCL when
+// 	Runtime::instance() finds a device and falls back to Native, saying
+// 	why on stderr, when it does not; throws std::runtime_error for an
+// 	unknown name
+Backend select_backend();
+
+// Device type selected by CLP_DEVICE_TYPE (CL_DEVICE_TYPE_ALL when unset);
+// 	throws std::runtime_error for an unknown type
+cl_device_type selected_device_type();
+
+// OpenCL C spelling of a host scalar type, for -DREAL=... build options
+template <typename Real>
+const char* cl_type_name();
+
+template <>
+inline const char* cl_type_name<float>()
+{
+    return "float";
+}
+
+template <>
+inline const char* cl_type_name<double>()
+{
+    return "double";
+}
+
+// Build options of a kernel source templated on REAL
+template <typename Real>
+std::string real_options()
+{
+    return std::string("-cl-std=CL2.0 -DREAL=") + cl_type_name<Real>();
+}
+
+}  // namespace clp
+
+#endif  // CXX_CL_RUNTIME_H
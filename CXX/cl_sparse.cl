@@ -0,0 +1,328 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Sparse Matrix Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* SpMV, Jacobi sweep and residual kernels for matrices stored in CSR	*
+* 	(compressed sparse row) and ELLPACK format. All kernels use one		*
+* 	work-item per row and tolerate a global size rounded up past n.		*
+*																		*
+* 	CSR: row i owns entries row_ptr[i] .. row_ptr[i+1]-1 of cols/vals	*
+* 	ELL: every row has "width" slots stored column-major, slot s of row	*
+* 		 i at [i + n*s]; padding slots have column -1					*
+*																		*
+* 	REAL  scalar type, float or double (default double)					*
+************************************************************************/
+
+#ifndef REAL
+#define REAL double
+#endif
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* Work-Group Norm Reduction Helper 										*
+************************************************************************/
+// Tree reduces max|r| and sum r^2 over the work-group (power of two local
+// 	size) and writes one partial per group. Every work-item must call it.
+void reduce_norm_partials(REAL r, __global REAL *partial_max, __global REAL *partial_sq,
+							__local REAL *smax, __local REAL *ssq){
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	smax[lid] = fabs(r);
+	ssq[lid]  = r*r;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			smax[lid] = fmax(smax[lid], smax[lid+offset]);
+			ssq[lid] += ssq[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+
+	if (lid == 0){
+		partial_max[get_group_id(0)] = smax[0];
+		partial_sq[get_group_id(0)]  = ssq[0];
+	}/*end if*/
+}
+
+
+/************************************************************************
+* CSR Kernels 															*
+************************************************************************/
+
+// y = A*x
+__kernel void cl_spmv_csr(int n, const __global int *row_ptr, const __global int *cols,
+							const __global REAL *vals, const __global REAL *x,
+							__global REAL *y){
+	int row = get_global_id(0);
+	if (row >= n){
+		return;
+	}/*end if*/
+
+	REAL sum = 0;
+	int k;
+	for (k = row_ptr[row]; k < row_ptr[row+1]; k++){
+		sum += vals[k]*x[cols[k]];
+	}/*end k*/
+	y[row] = sum;
+}
+
+// x = D^-1 (b - (A - D) xn)
+__kernel void cl_jacobi_csr(int n, const __global int *row_ptr, const __global int *cols,
+							const __global REAL *vals, const __global REAL *b,
+							const __global REAL *xn, __global REAL *x){
+	int row = get_global_id(0);
+	if (row >= n){
+		return;
+	}/*end if*/
+
+	REAL sum  = 0;
+	REAL diag = 1;
+	int k;
+	for (k = row_ptr[row]; k < row_ptr[row+1]; k++){
+		if (cols[k] == row){
+			diag = vals[k];
+		} else {
+			sum += vals[k]*xn[cols[k]];
+		}/*end if*/
+	}/*end k*/
+	x[row] = (b[row] - sum)/diag;
+}
+
+// In-place Gauss-Seidel/SOR pass over the rows of one colour (see cl_sor)
+__kernel void cl_sor_csr(int n, const __global int *row_ptr, const __global int *cols,
+							const __global REAL *vals, const __global REAL *b, __global REAL *x,
+							const __global int *rows, int first, int count, REAL omega){
+	int i = get_global_id(0);
+	if (i >= count){
+		return;
+	}/*end if*/
+
+	int row   = rows[first + i];
+	REAL sum  = 0;
+	REAL diag = 1;
+	int k;
+	for (k = row_ptr[row]; k < row_ptr[row+1]; k++){
+		if (cols[k] == row){
+			diag = vals[k];
+		} else {
+			sum += vals[k]*x[cols[k]];
+		}/*end if*/
+	}/*end k*/
+	x[row] += omega*((b[row] - sum)/diag - x[row]);
+}
+
+// d = diag(A); 0 for rows without a stored diagonal
+__kernel void cl_diagonal_csr(int n, const __global int *row_ptr, const __global int *cols,
+							const __global REAL *vals, __global REAL *d){
+	int row = get_global_id(0);
+	if (row >= n){
+		return;
+	}/*end if*/
+
+	REAL diag = 0;
+	int k;
+	for (k = row_ptr[row]; k < row_ptr[row+1]; k++){
+		if (cols[k] == row){
+			diag = vals[k];
+		}/*end if*/
+	}/*end k*/
+	d[row] = diag;
+}
+
+// One partial max|b - Ax| and sum (b - Ax)^2 per work-group
+__kernel void cl_residual_partial_csr(int n, const __global int *row_ptr, const __global int *cols,
+							const __global REAL *vals, const __global REAL *b,
+							const __global REAL *x, __global REAL *partial_max,
+							__global REAL *partial_sq, __local REAL *smax,
+							__local REAL *ssq){
+	int row = get_global_id(0);
+
+	REAL r = 0;
+	if (row < n){
+		REAL sum = 0;
+		int k;
+		for (k = row_ptr[row]; k < row_ptr[row+1]; k++){
+			sum += vals[k]*x[cols[k]];
+		}/*end k*/
+		r = b[row] - sum;
+	}/*end if*/
+
+	reduce_norm_partials(r, partial_max, partial_sq, smax, ssq);
+}
+
+// cl_jacobi_csr and cl_residual_partial_csr in one pass over the row: x
+// 	from xn as in the sweep, and the residual of xn reduced per group
+__kernel void cl_jacobi_residual_csr(int n, const __global int *row_ptr, const __global int *cols,
+							const __global REAL *vals, const __global REAL *b,
+							const __global REAL *xn, __global REAL *x,
+							__global REAL *partial_max, __global REAL *partial_sq,
+							__local REAL *smax, __local REAL *ssq){
+	int row = get_global_id(0);
+
+	REAL r = 0;
+	if (row < n){
+		REAL sum  = 0;
+		REAL diag = 1;
+		int k;
+		for (k = row_ptr[row]; k < row_ptr[row+1]; k++){
+			if (cols[k] == row){
+				diag = vals[k];
+			} else {
+				sum += vals[k]*xn[cols[k]];
+			}/*end if*/
+		}/*end k*/
+		x[row] = (b[row] - sum)/diag;
+		r = b[row] - sum - diag*xn[row];
+	}/*end if*/
+
+	reduce_norm_partials(r, partial_max, partial_sq, smax, ssq);
+}
+
+
+/************************************************************************
+* ELLPACK Kernels 														*
+************************************************************************/
+
+// y = A*x
+__kernel void cl_spmv_ell(int n, int width, const __global int *cols, const __global REAL *vals,
+							const __global REAL *x, __global REAL *y){
+	int row = get_global_id(0);
+	if (row >= n){
+		return;
+	}/*end if*/
+
+	REAL sum = 0;
+	int s;
+	for (s = 0; s < width; s++){
+		int col = cols[row + n*s];
+		if (col >= 0){
+			sum += vals[row + n*s]*x[col];
+		}/*end if*/
+	}/*end s*/
+	y[row] = sum;
+}
+
+// x = D^-1 (b - (A - D) xn)
+__kernel void cl_jacobi_ell(int n, int width, const __global int *cols, const __global REAL *vals,
+							const __global REAL *b, const __global REAL *xn,
+							__global REAL *x){
+	int row = get_global_id(0);
+	if (row >= n){
+		return;
+	}/*end if*/
+
+	REAL sum  = 0;
+	REAL diag = 1;
+	int s;
+	for (s = 0; s < width; s++){
+		int col = cols[row + n*s];
+		if (col == row){
+			diag = vals[row + n*s];
+		} else if (col >= 0){
+			sum += vals[row + n*s]*xn[col];
+		}/*end if*/
+	}/*end s*/
+	x[row] = (b[row] - sum)/diag;
+}
+
+// In-place Gauss-Seidel/SOR pass over the rows of one colour (see cl_sor)
+__kernel void cl_sor_ell(int n, int width, const __global int *cols, const __global REAL *vals,
+							const __global REAL *b, __global REAL *x, const __global int *rows,
+							int first, int count, REAL omega){
+	int i = get_global_id(0);
+	if (i >= count){
+		return;
+	}/*end if*/
+
+	int row   = rows[first + i];
+	REAL sum  = 0;
+	REAL diag = 1;
+	int s;
+	for (s = 0; s < width; s++){
+		int col = cols[row + n*s];
+		if (col == row){
+			diag = vals[row + n*s];
+		} else if (col >= 0){
+			sum += vals[row + n*s]*x[col];
+		}/*end if*/
+	}/*end s*/
+	x[row] += omega*((b[row] - sum)/diag - x[row]);
+}
+
+// d = diag(A); 0 for rows without a stored diagonal
+__kernel void cl_diagonal_ell(int n, int width, const __global int *cols, const __global REAL *vals,
+							__global REAL *d){
+	int row = get_global_id(0);
+	if (row >= n){
+		return;
+	}/*end if*/
+
+	REAL diag = 0;
+	int s;
+	for (s = 0; s < width; s++){
+		if (cols[row + n*s] == row){
+			diag = vals[row + n*s];
+		}/*end if*/
+	}/*end s*/
+	d[row] = diag;
+}
+
+// One partial max|b - Ax| and sum (b - Ax)^2 per work-group
+__kernel void cl_residual_partial_ell(int n, int width, const __global int *cols,
+							const __global REAL *vals, const __global REAL *b,
+							const __global REAL *x, __global REAL *partial_max,
+							__global REAL *partial_sq, __local REAL *smax,
+							__local REAL *ssq){
+	int row = get_global_id(0);
+
+	REAL r = 0;
+	if (row < n){
+		REAL sum = 0;
+		int s;
+		for (s = 0; s < width; s++){
+			int col = cols[row + n*s];
+			if (col >= 0){
+				sum += vals[row + n*s]*x[col];
+			}/*end if*/
+		}/*end s*/
+		r = b[row] - sum;
+	}/*end if*/
+
+	reduce_norm_partials(r, partial_max, partial_sq, smax, ssq);
+}
+
+// cl_jacobi_ell and cl_residual_partial_ell in one pass over the row
+__kernel void cl_jacobi_residual_ell(int n, int width, const __global int *cols,
+							const __global REAL *vals, const __global REAL *b,
+							const __global REAL *xn, __global REAL *x,
+							__global REAL *partial_max, __global REAL *partial_sq,
+							__local REAL *smax, __local REAL *ssq){
+	int row = get_global_id(0);
+
+	REAL r = 0;
+	if (row < n){
+		REAL sum  = 0;
+		REAL diag = 1;
+		int s;
+		for (s = 0; s < width; s++){
+			int col = cols[row + n*s];
+			if (col == row){
+				diag = vals[row + n*s];
+			} else if (col >= 0){
+				sum += vals[row + n*s]*xn[col];
+			}/*end if*/
+		}/*end s*/
+		x[row] = (b[row] - sum)/diag;
+		r = b[row] - sum - diag*xn[row];
+	}/*end if*/
+
+	reduce_norm_partials(r, partial_max, partial_sq, smax, ssq);
+}
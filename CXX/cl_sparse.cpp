@@ -0,0 +1,388 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Sparse Matrices
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_sparse.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace clp
+{
+namespace
+{
+
+// Read-only device copy of a host vector
+template <typename T>
+cl::Buffer device_copy(const std::vector<T>& host)
+{
+    return cl::Buffer(Runtime::instance().context(),
+                      CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                      sizeof(T) * host.size(),
+                      const_cast<T*>(host.data()));
+}
+
+void require_square(int rows, int cols, const char* who)
+{
+    if (rows != cols)
+    {
+        throw std::invalid_argument(std::string(who) + ": the solvers need a square matrix");
+    }
+}
+
+}  // namespace
+
+/************************************************************************
+ * Host Builders														*
+ ************************************************************************/
+
+CsrMatrix csr_from_dense(const double* A, int rows, int cols)
+{
+    CsrMatrix csr;
+    csr.rows = rows;
+    csr.cols = cols;
+    csr.row_ptr.reserve(rows + 1);
+    csr.row_ptr.push_back(0);
+
+    int i, j;
+    for (i = 0; i < rows; i++)
+    {
+        for (j = 0; j < cols; j++)
+        {
+            if (A[j + cols * i] != 0)
+            {
+                csr.col_idx.push_back(j);
+                csr.values.push_back(A[j + cols * i]);
+            }
+        }  // end j
+        csr.row_ptr.push_back(csr.nnz());
+    }  // end i
+
+    return csr;
+}
+
+CsrMatrix tridiagonal_csr(int n, double lower, double diag, double upper)
+{
+    CsrMatrix csr;
+    csr.rows = n;
+    csr.cols = n;
+    csr.row_ptr.reserve(n + 1);
+    csr.col_idx.reserve(3 * n);
+    csr.values.reserve(3 * n);
+    csr.row_ptr.push_back(0);
+
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        if (i > 0)
+        {
+            csr.col_idx.push_back(i - 1);
+            csr.values.push_back(lower);
+        }
+        csr.col_idx.push_back(i);
+        csr.values.push_back(diag);
+        if (i < n - 1)
+        {
+            csr.col_idx.push_back(i + 1);
+            csr.values.push_back(upper);
+        }
+        csr.row_ptr.push_back(csr.nnz());
+    }  // end i
+
+    return csr;
+}
+
+CsrMatrix poisson2d_csr(int nx, int ny)
+{
+    CsrMatrix csr;
+    csr.rows = nx * ny;
+    csr.cols = nx * ny;
+    csr.row_ptr.reserve(csr.rows + 1);
+    csr.col_idx.reserve(5 * csr.rows);
+    csr.values.reserve(5 * csr.rows);
+    csr.row_ptr.push_back(0);
+
+    // Columns ascending: south, west, centre, east, north
+    int i, j;
+    for (j = 0; j < ny; j++)
+    {
+        for (i = 0; i < nx; i++)
+        {
+            const int row = i + nx * j;
+            if (j > 0)
+            {
+                csr.col_idx.push_back(row - nx);
+                csr.values.push_back(-1.0);
+            }
+            if (i > 0)
+            {
+                csr.col_idx.push_back(row - 1);
+                csr.values.push_back(-1.0);
+            }
+            csr.col_idx.push_back(row);
+            csr.values.push_back(4.0);
+            if (i < nx - 1)
+            {
+                csr.col_idx.push_back(row + 1);
+                csr.values.push_back(-1.0);
+            }
+            if (j < ny - 1)
+            {
+                csr.col_idx.push_back(row + nx);
+                csr.values.push_back(-1.0);
+            }
+            csr.row_ptr.push_back(csr.nnz());
+        }  // end i
+    }  // end j
+
+    return csr;
+}
+
+EllMatrix ell_from_csr(const CsrMatrix& A)
+{
+    EllMatrix ell;
+    ell.rows = A.rows;
+    ell.cols = A.cols;
+
+    // [A]:Width of the longest row (at least one slot, so buffers are never empty)
+    int i, k;
+    ell.width = 1;
+    for (i = 0; i < A.rows; i++)
+    {
+        ell.width = std::max(ell.width, A.row_ptr[i + 1] - A.row_ptr[i]);
+    }  // end i
+
+    // [B]:Scatter into column-major slots
+    const std::size_t slots = static_cast<std::size_t>(ell.width) * A.rows;
+    ell.col_idx.assign(slots, -1);
+    ell.values.assign(slots, 0.0);
+    for (i = 0; i < A.rows; i++)
+    {
+        for (k = A.row_ptr[i]; k < A.row_ptr[i + 1]; k++)
+        {
+            const std::size_t slot = i + static_cast<std::size_t>(A.rows) * (k - A.row_ptr[i]);
+            ell.col_idx[slot] = A.col_idx[k];
+            ell.values[slot] = A.values[k];
+        }  // end k
+    }  // end i
+
+    return ell;
+}
+
+Colouring greedy_colouring(const CsrMatrix& A)
+{
+    const int n = A.rows;
+
+    // [A]:Transposed pattern, so that row i also sees the rows that reference it
+    std::vector<int> t_ptr(n + 1, 0);
+    std::vector<int> t_idx(A.nnz());
+    int i, k;
+    for (k = 0; k < A.nnz(); k++)
+    {
+        t_ptr[A.col_idx[k] + 1]++;
+    }  // end k
+    for (i = 0; i < n; i++)
+    {
+        t_ptr[i + 1] += t_ptr[i];
+    }  // end i
+    std::vector<int> fill(t_ptr.begin(), t_ptr.end() - 1);
+    for (i = 0; i < n; i++)
+    {
+        for (k = A.row_ptr[i]; k < A.row_ptr[i + 1]; k++)
+        {
+            t_idx[fill[A.col_idx[k]]++] = i;
+        }  // end k
+    }  // end i
+
+    // [B]:Smallest colour unused by any coloured neighbour; "seen" holds
+    // 	the last row that ruled each colour out
+    std::vector<int> colour(n, -1);
+    std::vector<int> seen;
+    int colours = 0;
+    auto rule_out = [&](int row, int neighbour) {
+        if (neighbour != row && colour[neighbour] >= 0)
+        {
+            seen[colour[neighbour]] = row;
+        }
+    };
+    for (i = 0; i < n; i++)
+    {
+        seen.resize(colours + 1, -1);
+        for (k = A.row_ptr[i]; k < A.row_ptr[i + 1]; k++)
+        {
+            rule_out(i, A.col_idx[k]);
+        }  // end k
+        for (k = t_ptr[i]; k < t_ptr[i + 1]; k++)
+        {
+            rule_out(i, t_idx[k]);
+        }  // end k
+        int c = 0;
+        while (seen[c] == i)
+        {
+            c++;
+        }  // end while
+        colour[i] = c;
+        colours = std::max(colours, c + 1);
+    }  // end i
+
+    // [C]:Counting sort by colour, rows ascending within a colour
+    Colouring colouring;
+    colouring.colour_ptr.assign(colours + 1, 0);
+    for (i = 0; i < n; i++)
+    {
+        colouring.colour_ptr[colour[i] + 1]++;
+    }  // end i
+    for (k = 0; k < colours; k++)
+    {
+        colouring.colour_ptr[k + 1] += colouring.colour_ptr[k];
+    }  // end k
+    colouring.rows.resize(n);
+    fill.assign(colouring.colour_ptr.begin(), colouring.colour_ptr.end() - 1);
+    for (i = 0; i < n; i++)
+    {
+        colouring.rows[fill[colour[i]]++] = i;
+    }  // end i
+
+    return colouring;
+}
+
+Colouring greedy_colouring(const EllMatrix& A)
+{
+    // Only the pattern matters
+    CsrMatrix pattern;
+    pattern.rows = A.rows;
+    pattern.cols = A.cols;
+    pattern.row_ptr.push_back(0);
+    for (int i = 0; i < A.rows; i++)
+    {
+        for (int s = 0; s < A.width; s++)
+        {
+            const int col = A.col_idx[i + static_cast<std::size_t>(A.rows) * s];
+            if (col >= 0)
+            {
+                pattern.col_idx.push_back(col);
+                pattern.values.push_back(1.0);
+            }
+        }  // end s
+        pattern.row_ptr.push_back(pattern.nnz());
+    }  // end i
+    return greedy_colouring(pattern);
+}
+
+void spmv(const CsrMatrix& A, const double* x, double* y)
+{
+    int i, k;
+    for (i = 0; i < A.rows; i++)
+    {
+        double sum = 0;
+        for (k = A.row_ptr[i]; k < A.row_ptr[i + 1]; k++)
+        {
+            sum += A.values[k] * x[A.col_idx[k]];
+        }  // end k
+        y[i] = sum;
+    }  // end i
+}
+
+void require_diagonal(const CsrMatrix& A, const char* who)
+{
+    for (int row = 0; row < A.rows; row++)
+    {
+        bool found = false;
+        for (int k = A.row_ptr[row]; k < A.row_ptr[row + 1]; k++)
+        {
+            found = found || (A.col_idx[k] == row && A.values[k] != 0.0);
+        }  // end k
+        if (!found)
+        {
+            throw std::invalid_argument(std::string(who) + ": no non-zero diagonal entry in row " +
+                                        std::to_string(row));
+        }
+    }  // end row
+}
+
+void require_diagonal(const EllMatrix& A, const char* who)
+{
+    for (int row = 0; row < A.rows; row++)
+    {
+        bool found = false;
+        for (int s = 0; s < A.width; s++)
+        {
+            const std::size_t slot = row + static_cast<std::size_t>(A.rows) * s;
+            found = found || (A.col_idx[slot] == row && A.values[slot] != 0.0);
+        }  // end s
+        if (!found)
+        {
+            throw std::invalid_argument(std::string(who) + ": no non-zero diagonal entry in row " +
+                                        std::to_string(row));
+        }
+    }  // end row
+}
+
+/************************************************************************
+ * Device Operators														*
+ ************************************************************************/
+
+template <typename Real>
+CsrOperator<Real>::CsrOperator(const CsrMatrix& A)
+    : KernelOperator(A.rows,
+                     sizeof(Real),
+                     4,
+                     build_program(load_kernel_source("cl_sparse.cl"), real_options<Real>()),
+                     "cl_spmv_csr",
+                     "cl_diagonal_csr",
+                     "cl_jacobi_csr",
+                     "cl_sor_csr",
+                     "cl_residual_partial_csr",
+                     "cl_jacobi_residual_csr")
+{
+    require_square(A.rows, A.cols, "CsrOperator");
+    if (A.nnz() == 0)
+    {
+        throw std::invalid_argument("CsrOperator: the matrix has no nonzeros");
+    }
+    require_diagonal(A, "CsrOperator");
+
+    row_ptr_ = device_copy(A.row_ptr);
+    col_idx_ = device_copy(A.col_idx);
+    values_ = device_copy(std::vector<Real>(A.values.begin(), A.values.end()));
+
+    bind_matrix(0, A.rows);
+    bind_matrix(1, row_ptr_);
+    bind_matrix(2, col_idx_);
+    bind_matrix(3, values_);
+    bind_colouring(greedy_colouring(A));
+}
+
+template <typename Real>
+EllOperator<Real>::EllOperator(const EllMatrix& A)
+    : KernelOperator(A.rows,
+                     sizeof(Real),
+                     4,
+                     build_program(load_kernel_source("cl_sparse.cl"), real_options<Real>()),
+                     "cl_spmv_ell",
+                     "cl_diagonal_ell",
+                     "cl_jacobi_ell",
+                     "cl_sor_ell",
+                     "cl_residual_partial_ell",
+                     "cl_jacobi_residual_ell")
+{
+    require_square(A.rows, A.cols, "EllOperator");
+    require_diagonal(A, "EllOperator");
+
+    col_idx_ = device_copy(A.col_idx);
+    values_ = device_copy(std::vector<Real>(A.values.begin(), A.values.end()));
+
+    bind_matrix(0, A.rows);
+    bind_matrix(1, A.width);
+    bind_matrix(2, col_idx_);
+    bind_matrix(3, values_);
+    bind_colouring(greedy_colouring(A));
+}
+
+template class CsrOperator<float>;
+template class CsrOperator<double>;
+template class EllOperator<float>;
+template class EllOperator<double>;
+
+}  // namespace clp
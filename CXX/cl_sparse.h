@@ -0,0 +1,112 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Sparse Matrices
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Host-side CSR and ELLPACK matrices, builders, and the matching		*
+ * 	device operators backed by cl_sparse.cl. CSR suits rows of uneven	*
+ * 	length; ELL pads every row to the longest one and stores the slots	*
+ * 	column-major, so neighbouring work-items read neighbouring words.	*
+ * 	The host formats are double; the device operators store the values	*
+ * 	as their template scalar (float or double).							*
+ ************************************************************************/
+
+#ifndef CXX_CL_SPARSE_H
+#define CXX_CL_SPARSE_H
+
+#include "cl_operator.h"
+#include <vector>
+
+namespace clp
+{
+
+/************************************************************************
+ * Host Formats															*
+ ************************************************************************/
+
+// Compressed sparse row: row i owns entries row_ptr[i] .. row_ptr[i+1]-1
+// 	of col_idx/values, columns ascending
+struct CsrMatrix
+{
+    int rows = 0;
+    int cols = 0;
+    std::vector<int> row_ptr;
+    std::vector<int> col_idx;
+    std::vector<double> values;
+
+    int nnz() const { return static_cast<int>(values.size()); }
+};
+
+// ELLPACK: "width" slots per row, slot s of row i at [i + rows*s]. Padding
+// 	slots have column -1 and value 0
+struct EllMatrix
+{
+    int rows = 0;
+    int cols = 0;
+    int width = 0;
+    std::vector<int> col_idx;
+    std::vector<double> values;
+};
+
+// Keeps the nonzeros of a row-major rows x cols array
+CsrMatrix csr_from_dense(const double* A, int rows, int cols);
+
+// n x n matrix with "lower", "diag", "upper" on the three central
+// 	diagonals, e.g. (-1, 2, -1) for the 1-D Poisson problem
+CsrMatrix tridiagonal_csr(int n, double lower, double diag, double upper);
+
+// 2-D Poisson matrix of an nx x ny grid (5-point stencil: 4 on the diagonal,
+// 	-1 per neighbour, Dirichlet boundaries), unknowns numbered x fastest
+CsrMatrix poisson2d_csr(int nx, int ny);
+
+EllMatrix ell_from_csr(const CsrMatrix& A);
+
+// Greedy colouring of the pattern of A + A^T, rows taken in order; gives
+// 	the red-black colouring of 1-D and 5-point Poisson matrices
+Colouring greedy_colouring(const CsrMatrix& A);
+Colouring greedy_colouring(const EllMatrix& A);
+
+// y = A*x on the host
+void spmv(const CsrMatrix& A, const double* x, double* y);
+
+// Throws std::invalid_argument naming "who" and the first row without a
+// 	non-zero diagonal entry, which every Jacobi sweep divides by
+void require_diagonal(const CsrMatrix& A, const char* who);
+void require_diagonal(const EllMatrix& A, const char* who);
+
+/************************************************************************
+ * Device Operators														*
+ ************************************************************************/
+
+template <typename Real>
+class CsrOperator : public KernelOperator
+{
+  public:
+    explicit CsrOperator(const CsrMatrix& A);
+
+  private:
+    cl::Buffer row_ptr_;
+    cl::Buffer col_idx_;
+    cl::Buffer values_;
+};
+
+template <typename Real>
+class EllOperator : public KernelOperator
+{
+  public:
+    explicit EllOperator(const EllMatrix& A);
+
+  private:
+    cl::Buffer col_idx_;
+    cl::Buffer values_;
+};
+
+extern template class CsrOperator<float>;
+extern template class CsrOperator<double>;
+extern template class EllOperator<float>;
+extern template class EllOperator<double>;
+
+}  // namespace clp
+
+#endif  // CXX_CL_SPARSE_H
@@ -0,0 +1,248 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Sparse Matrix Tests
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_sparse.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+// Row-major n x n matrix with a few nonzeros per row, no two rows alike
+std::vector<double> test_dense(int n)
+{
+    std::vector<double> A(static_cast<std::size_t>(n) * n, 0.0);
+    for (int i = 0; i < n; i++)
+    {
+        A[i + n * i] = 10.0 + i;
+        A[(3 * i + 1) % n + n * i] += -1.0 - 0.5 * (i % 3);
+        A[(i * i + 2) % n + n * i] += 0.25 * (i % 5);
+    }  // end i
+    return A;
+}
+
+std::vector<double> test_vector(int n)
+{
+    std::vector<double> x(n);
+    for (int i = 0; i < n; i++)
+    {
+        x[i] = std::cos(static_cast<double>(i)) + 1.5;
+    }  // end i
+    return x;
+}
+
+// y = A*x straight from the ELL slots
+std::vector<double> ell_spmv(const clp::EllMatrix& A, const std::vector<double>& x)
+{
+    std::vector<double> y(A.rows, 0.0);
+    for (int i = 0; i < A.rows; i++)
+    {
+        for (int s = 0; s < A.width; s++)
+        {
+            const std::size_t slot = i + static_cast<std::size_t>(A.rows) * s;
+            if (A.col_idx[slot] >= 0)
+            {
+                y[i] += A.values[slot] * x[A.col_idx[slot]];
+            }
+        }  // end s
+    }  // end i
+    return y;
+}
+
+// Every row in exactly one colour, and no entry of A (or A^T) joining two
+// 	rows of the same colour
+void expect_valid_colouring(const clp::CsrMatrix& A, const clp::Colouring& colouring)
+{
+    ASSERT_GE(colouring.colours(), 1);
+    ASSERT_EQ(colouring.colour_ptr.front(), 0);
+    ASSERT_EQ(colouring.colour_ptr.back(), A.rows);
+    ASSERT_EQ(static_cast<int>(colouring.rows.size()), A.rows);
+
+    std::vector<int> colour(A.rows, -1);
+    for (int c = 0; c < colouring.colours(); c++)
+    {
+        for (int k = colouring.colour_ptr[c]; k < colouring.colour_ptr[c + 1]; k++)
+        {
+            ASSERT_EQ(colour[colouring.rows[k]], -1) << "row " << colouring.rows[k] << " coloured twice";
+            colour[colouring.rows[k]] = c;
+        }  // end k
+    }  // end c
+    for (int i = 0; i < A.rows; i++)
+    {
+        for (int k = A.row_ptr[i]; k < A.row_ptr[i + 1]; k++)
+        {
+            const int j = A.col_idx[k];
+            if (j != i)
+            {
+                EXPECT_NE(colour[i], colour[j]) << "rows " << i << " and " << j;
+            }
+        }  // end k
+    }  // end i
+}
+
+}  // namespace
+
+/************************************************************************
+ * Builders																*
+ ************************************************************************/
+
+TEST(SparseTest, CsrFromDenseKeepsTheNonzeros)
+{
+    const int n = 23;
+    const std::vector<double> dense = test_dense(n);
+    const clp::CsrMatrix A = clp::csr_from_dense(dense.data(), n, n);
+
+    ASSERT_EQ(A.rows, n);
+    ASSERT_EQ(A.cols, n);
+    ASSERT_EQ(static_cast<int>(A.row_ptr.size()), n + 1);
+    for (int i = 0; i < n; i++)
+    {
+        for (int k = A.row_ptr[i]; k < A.row_ptr[i + 1]; k++)
+        {
+            EXPECT_NE(A.values[k], 0.0);
+            EXPECT_EQ(A.values[k], dense[A.col_idx[k] + n * i]);
+            if (k > A.row_ptr[i])
+            {
+                EXPECT_LT(A.col_idx[k - 1], A.col_idx[k]) << "row " << i;
+            }
+        }  // end k
+    }  // end i
+
+    const std::vector<double> x = test_vector(n);
+    std::vector<double> y(n);
+    clp::spmv(A, x.data(), y.data());
+    for (int i = 0; i < n; i++)
+    {
+        double expected = 0.0;
+        for (int j = 0; j < n; j++)
+        {
+            expected += dense[j + n * i] * x[j];
+        }  // end j
+        EXPECT_NEAR(y[i], expected, 1e-12);
+    }  // end i
+}
+
+TEST(SparseTest, TridiagonalAndPoissonMatchTheirStencils)
+{
+    const clp::CsrMatrix T = clp::tridiagonal_csr(9, -1.0, 2.0, -3.0);
+    EXPECT_EQ(T.nnz(), 3 * 9 - 2);
+    for (int i = 0; i < T.rows; i++)
+    {
+        for (int k = T.row_ptr[i]; k < T.row_ptr[i + 1]; k++)
+        {
+            const int offset = T.col_idx[k] - i;
+            EXPECT_EQ(T.values[k], offset == -1 ? -1.0 : offset == 0 ? 2.0 : -3.0);
+        }  // end k
+    }  // end i
+
+    const int nx = 7, ny = 5;
+    const clp::CsrMatrix P = clp::poisson2d_csr(nx, ny);
+    ASSERT_EQ(P.rows, nx * ny);
+    EXPECT_EQ(P.nnz(), 5 * nx * ny - 2 * nx - 2 * ny);
+    for (int j = 0; j < ny; j++)
+    {
+        for (int i = 0; i < nx; i++)
+        {
+            const int row = i + nx * j;
+            double sum = 0.0;
+            for (int k = P.row_ptr[row]; k < P.row_ptr[row + 1]; k++)
+            {
+                sum += P.values[k];
+                if (k > P.row_ptr[row])
+                {
+                    EXPECT_LT(P.col_idx[k - 1], P.col_idx[k]);
+                }
+            }  // end k
+            // Row sums are 4 minus the neighbours inside the grid
+            const int neighbours = (i > 0) + (i < nx - 1) + (j > 0) + (j < ny - 1);
+            EXPECT_EQ(sum, 4.0 - neighbours) << "point (" << i << ", " << j << ")";
+        }  // end i
+    }  // end j
+}
+
+TEST(SparseTest, EllFromCsrPadsAndMultipliesAlike)
+{
+    const int n = 31;
+    const std::vector<double> dense = test_dense(n);
+    const clp::CsrMatrix A = clp::csr_from_dense(dense.data(), n, n);
+    const clp::EllMatrix E = clp::ell_from_csr(A);
+
+    int width = 0;
+    for (int i = 0; i < n; i++)
+    {
+        width = std::max(width, A.row_ptr[i + 1] - A.row_ptr[i]);
+    }  // end i
+    ASSERT_EQ(E.width, width);
+    ASSERT_EQ(E.col_idx.size(), static_cast<std::size_t>(width) * n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int s = A.row_ptr[i + 1] - A.row_ptr[i]; s < E.width; s++)
+        {
+            EXPECT_EQ(E.col_idx[i + n * s], -1);
+            EXPECT_EQ(E.values[i + n * s], 0.0);
+        }  // end s
+    }  // end i
+
+    const std::vector<double> x = test_vector(n);
+    std::vector<double> y(n);
+    clp::spmv(A, x.data(), y.data());
+    const std::vector<double> y_ell = ell_spmv(E, x);
+    for (int i = 0; i < n; i++)
+    {
+        EXPECT_EQ(y_ell[i], y[i]) << "row " << i;
+    }  // end i
+}
+
+TEST(SparseTest, RequireDiagonalRejectsMissingOrZeroDiagonals)
+{
+    const clp::CsrMatrix good = clp::poisson2d_csr(4, 3);
+    EXPECT_NO_THROW(clp::require_diagonal(good, "test"));
+    EXPECT_NO_THROW(clp::require_diagonal(clp::ell_from_csr(good), "test"));
+
+    // Row 1 of [[2, 1, 0], [1, 0, 1], [0, 1, 2]] has no stored diagonal
+    const double missing[] = {2, 1, 0, 1, 0, 1, 0, 1, 2};
+    const clp::CsrMatrix A = clp::csr_from_dense(missing, 3, 3);
+    EXPECT_THROW(clp::require_diagonal(A, "test"), std::invalid_argument);
+    EXPECT_THROW(clp::require_diagonal(clp::ell_from_csr(A), "test"), std::invalid_argument);
+
+    // A stored zero is no better
+    clp::CsrMatrix zero = clp::tridiagonal_csr(5, -1.0, 2.0, -1.0);
+    zero.values[zero.row_ptr[3] + 1] = 0.0;
+    EXPECT_THROW(clp::require_diagonal(zero, "test"), std::invalid_argument);
+}
+
+/************************************************************************
+ * Colouring															*
+ ************************************************************************/
+
+TEST(SparseTest, PoissonColouringIsRedBlack)
+{
+    const clp::CsrMatrix T = clp::tridiagonal_csr(50, -1.0, 2.0, -1.0);
+    const clp::Colouring t_colours = clp::greedy_colouring(T);
+    EXPECT_EQ(t_colours.colours(), 2);
+    expect_valid_colouring(T, t_colours);
+
+    const clp::CsrMatrix P = clp::poisson2d_csr(12, 9);
+    const clp::Colouring p_colours = clp::greedy_colouring(P);
+    EXPECT_EQ(p_colours.colours(), 2);
+    expect_valid_colouring(P, p_colours);
+}
+
+TEST(SparseTest, ColouringCoversUnsymmetricPatterns)
+{
+    // An unsymmetric pattern: row i may reference j without j referencing
+    // 	i, so the colouring must see A^T as well
+    const int n = 40;
+    const std::vector<double> dense = test_dense(n);
+    const clp::CsrMatrix A = clp::csr_from_dense(dense.data(), n, n);
+    expect_valid_colouring(A, clp::greedy_colouring(A));
+
+    // The ELL overload colours the same pattern
+    const clp::Colouring ell = clp::greedy_colouring(clp::ell_from_csr(A));
+    expect_valid_colouring(A, ell);
+}
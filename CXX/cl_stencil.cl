@@ -0,0 +1,247 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Matrix-Free Stencil Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* The negative Laplacian of a structured nx x ny x nz grid, applied		*
+* 	without storing a matrix: 2*dims on the diagonal ("diag") and -1	*
+* 	per neighbour, i.e. the 3-point (1-D), 5-point (2-D) or 7-point		*
+* 	(3-D) stencil. Unknowns are the interior points numbered x fastest,	*
+* 	idx = i + nx*(j + ny*k); a neighbour outside the grid is the zero	*
+* 	Dirichlet boundary (non-zero boundary values belong in b). Unused	*
+* 	dimensions have extent 1.											*
+*																		*
+* 	The apply and Jacobi kernels run on a 3-D range of (lx, ly, 1)		*
+* 	work-groups: each group stages its block of plane k plus a one		*
+* 	point halo in local memory ("tile", (lx+2)*(ly+2) scalars) and		*
+* 	reads the x and y neighbours from there; z neighbours come from		*
+* 	global memory. Global sizes are rounded up past the grid.			*
+*																		*
+* 	REAL  scalar type, float or double (default double)					*
+************************************************************************/
+
+#ifndef REAL
+#define REAL double
+#endif
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* Halo Tiling Helpers 													*
+************************************************************************/
+// Stages the work-group's block of plane k of v with its halo. Every
+// 	work-item must call it, padding ones included.
+void load_tile(int nx, int ny, int nz, const __global REAL *v, __local REAL *tile){
+	int lx = get_local_size(0);
+	int ly = get_local_size(1);
+	int x0 = get_group_id(0)*lx - 1;
+	int y0 = get_group_id(1)*ly - 1;
+	int k  = get_global_id(2);
+
+	int t;
+	for (t = get_local_id(0) + lx*get_local_id(1); t < (lx+2)*(ly+2); t += lx*ly){
+		int i = x0 + t%(lx+2);
+		int j = y0 + t/(lx+2);
+		tile[t] = (i >= 0 && i < nx && j >= 0 && j < ny && k < nz) ? v[i + nx*(j + ny*k)] : 0;
+	}/*end t*/
+	barrier(CLK_LOCAL_MEM_FENCE);
+}
+
+// Sum of the neighbours of this work-item's point: x and y from the tile,
+// 	z from global memory. Returns the point's own value in *centre.
+REAL tile_neighbour_sum(int nx, int ny, int nz, const __global REAL *v, __local REAL *tile,
+							REAL *centre){
+	int lx = get_local_size(0);
+	int c  = (get_local_id(0)+1) + (lx+2)*(get_local_id(1)+1);
+	int k  = get_global_id(2);
+	int idx = get_global_id(0) + nx*(get_global_id(1) + ny*k);
+
+	*centre = tile[c];
+	REAL sum = tile[c-1] + tile[c+1] + tile[c-(lx+2)] + tile[c+(lx+2)];
+	if (k > 0){
+		sum += v[idx - nx*ny];
+	}/*end if*/
+	if (k < nz-1){
+		sum += v[idx + nx*ny];
+	}/*end if*/
+	return sum;
+}
+
+// The same sum straight from global memory, for the untiled kernels
+REAL neighbour_sum(int nx, int ny, int nz, const __global REAL *v, int i, int j, int k){
+	int idx = i + nx*(j + ny*k);
+	REAL sum = 0;
+	if (i > 0)		sum += v[idx - 1];
+	if (i < nx-1)	sum += v[idx + 1];
+	if (j > 0)		sum += v[idx - nx];
+	if (j < ny-1)	sum += v[idx + nx];
+	if (k > 0)		sum += v[idx - nx*ny];
+	if (k < nz-1)	sum += v[idx + nx*ny];
+	return sum;
+}
+
+// True for the padding work-items of a rounded-up 3-D range
+int outside(int nx, int ny, int nz){
+	return get_global_id(0) >= nx || get_global_id(1) >= ny || get_global_id(2) >= nz;
+}
+
+
+
+/************************************************************************
+* Stencil Apply, Diagonal and Jacobi Sweep 								*
+************************************************************************/
+// y = A*x
+__kernel void cl_stencil_apply(int nx, int ny, int nz, REAL diag, const __global REAL *x,
+								__global REAL *y, __local REAL *tile){
+	load_tile(nx, ny, nz, x, tile);
+	if (outside(nx, ny, nz)){
+		return;
+	}/*end if*/
+
+	REAL centre;
+	REAL sum = tile_neighbour_sum(nx, ny, nz, x, tile, &centre);
+	y[get_global_id(0) + nx*(get_global_id(1) + ny*get_global_id(2))] = diag*centre - sum;
+}
+
+// d = diag(A), one work-item per unknown
+__kernel void cl_stencil_diagonal(int n, REAL diag, __global REAL *d){
+	int gid = get_global_id(0);
+	if (gid < n){
+		d[gid] = diag;
+	}/*end if*/
+}
+
+// x = D^-1 (b - (A - D) xn)
+__kernel void cl_stencil_jacobi(int nx, int ny, int nz, REAL diag, const __global REAL *b,
+								const __global REAL *xn, __global REAL *x, __local REAL *tile){
+	load_tile(nx, ny, nz, xn, tile);
+	if (outside(nx, ny, nz)){
+		return;
+	}/*end if*/
+
+	REAL centre;
+	REAL sum = tile_neighbour_sum(nx, ny, nz, xn, tile, &centre);
+	int idx = get_global_id(0) + nx*(get_global_id(1) + ny*get_global_id(2));
+	x[idx] = (b[idx] + sum)/diag;
+}
+
+
+
+/************************************************************************
+* Red-Black Gauss-Seidel / SOR Sweep 									*
+************************************************************************/
+// In-place pass over the points with (i + j + k) % 2 == colour; their
+// 	neighbours are all of the other colour. Launch on ((nx+1)/2, ny, nz):
+// 	work-item g of a row takes the g-th point of the colour along x.
+__kernel void cl_stencil_sor(int nx, int ny, int nz, REAL diag, const __global REAL *b,
+								__global REAL *x, int colour, REAL omega){
+	int j = get_global_id(1);
+	int k = get_global_id(2);
+	int i = 2*get_global_id(0) + ((j + k + colour) & 1);
+	if (i >= nx || j >= ny || k >= nz){
+		return;
+	}/*end if*/
+
+	int idx = i + nx*(j + ny*k);
+	REAL sum = neighbour_sum(nx, ny, nz, x, i, j, k);
+	x[idx] += omega*((b[idx] + sum)/diag - x[idx]);
+}
+
+
+
+/************************************************************************
+* Residual Norm Kernel: Pass 1 											*
+************************************************************************/
+// Same contract as cl_residual_partial in cl_jacobi.cl: a 1-D range of
+// 	power of two work-groups, one partial max|r| and sum r^2 per group.
+__kernel void cl_stencil_residual_partial(int nx, int ny, int nz, REAL diag, const __global REAL *b,
+								const __global REAL *x, __global REAL *partial_max,
+								__global REAL *partial_sq, __local REAL *smax,
+								__local REAL *ssq){
+	//[A]:Get Global and Local IDs
+	int gid   = get_global_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	//[B]:Point residual (padding work-items contribute zero)
+	REAL r = 0;
+	if (gid < nx*ny*nz){
+		int i = gid%nx;
+		int j = (gid/nx)%ny;
+		int k = gid/(nx*ny);
+		r = b[gid] - (diag*x[gid] - neighbour_sum(nx, ny, nz, x, i, j, k));
+	}/*end if*/
+
+	smax[lid] = fabs(r);
+	ssq[lid]  = r*r;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[C]:Tree reduction in local memory
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			smax[lid] = fmax(smax[lid], smax[lid+offset]);
+			ssq[lid] += ssq[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+
+	//[D]:One partial per work-group
+	if (lid == 0){
+		partial_max[get_group_id(0)] = smax[0];
+		partial_sq[get_group_id(0)]  = ssq[0];
+	}/*end if*/
+}
+
+
+
+/************************************************************************
+* Fused Jacobi Sweep and Residual 										*
+************************************************************************/
+// cl_stencil_jacobi and cl_stencil_residual_partial in one pass: the
+// 	neighbour sum of each point gives both the next iterate and the
+// 	residual of xn. Launched like the residual kernel (1-D, power of two
+// 	groups) and untiled, since the partials fix the work-group shape.
+__kernel void cl_stencil_jacobi_residual(int nx, int ny, int nz, REAL diag, const __global REAL *b,
+								const __global REAL *xn, __global REAL *x,
+								__global REAL *partial_max, __global REAL *partial_sq,
+								__local REAL *smax, __local REAL *ssq){
+	//[A]:Get Global and Local IDs
+	int gid   = get_global_id(0);
+	int lid   = get_local_id(0);
+	int lsize = get_local_size(0);
+
+	//[B]:Next iterate and point residual (padding work-items contribute zero)
+	REAL r = 0;
+	if (gid < nx*ny*nz){
+		int i = gid%nx;
+		int j = (gid/nx)%ny;
+		int k = gid/(nx*ny);
+		REAL sum = neighbour_sum(nx, ny, nz, xn, i, j, k);
+		x[gid] = (b[gid] + sum)/diag;
+		r = b[gid] + sum - diag*xn[gid];
+	}/*end if*/
+
+	smax[lid] = fabs(r);
+	ssq[lid]  = r*r;
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[C]:Tree reduction in local memory
+	int offset;
+	for (offset = lsize/2; offset > 0; offset /= 2){
+		if (lid < offset){
+			smax[lid] = fmax(smax[lid], smax[lid+offset]);
+			ssq[lid] += ssq[lid+offset];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+	}/*end offset*/
+
+	//[D]:One partial per work-group
+	if (lid == 0){
+		partial_max[get_group_id(0)] = smax[0];
+		partial_sq[get_group_id(0)]  = ssq[0];
+	}/*end if*/
+}
@@ -0,0 +1,200 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Matrix-Free Stencil Operators
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_stencil.h"
+#include "cl_profiler.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace clp
+{
+namespace
+{
+
+// n rounded up to a multiple of "local"
+std::size_t round_up(std::size_t n, std::size_t local)
+{
+    return (n + local - 1) / local * local;
+}
+
+}  // namespace
+
+template <typename Real>
+StencilOperator<Real>::StencilOperator(int nx, int ny, int nz)
+    : nx_(nx), ny_(std::max(ny, 1)), nz_(std::max(nz, 1)), dims_(1 + (ny > 0) + (nz > 0)), diag_(2 * dims_)
+{
+    if (nx < 1 || ny < 0 || nz < 0 || (nz > 0 && ny == 0))
+    {
+        throw std::invalid_argument("StencilOperator: expected nx >= 1, and ny >= 1 whenever nz is given");
+    }
+    if (static_cast<long long>(nx_) * ny_ * nz_ > std::numeric_limits<int>::max())
+    {
+        throw std::invalid_argument("StencilOperator: the grid has more points than an int can index");
+    }
+
+    // [A]:Kernels; the grid and diagonal are their leading arguments
+    cl::Program program = build_program(load_kernel_source("cl_stencil.cl"), real_options<Real>());
+    apply_ = cl::Kernel(program, "cl_stencil_apply");
+    diagonal_ = cl::Kernel(program, "cl_stencil_diagonal");
+    sweep_ = cl::Kernel(program, "cl_stencil_jacobi");
+    sor_ = cl::Kernel(program, "cl_stencil_sor");
+    residual_ = cl::Kernel(program, "cl_stencil_residual_partial");
+    fused_ = cl::Kernel(program, "cl_stencil_jacobi_residual");
+    for (cl::Kernel* kernel : {&apply_, &sweep_, &sor_, &residual_, &fused_})
+    {
+        kernel->setArg(0, nx_);
+        kernel->setArg(1, ny_);
+        kernel->setArg(2, nz_);
+        kernel->setArg(3, diag_);
+    }  // end kernel
+    diagonal_.setArg(0, rows());
+    diagonal_.setArg(1, diag_);
+
+    // [B]:Tile of one work-group: a 256 point run in 1-D, 16 x 16 otherwise,
+    // 	halved until both tiled kernels accept it
+    const cl::Device& device = Runtime::instance().device();
+    const std::size_t limit = std::min(apply_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device),
+                                       sweep_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device));
+    tile_x_ = dims_ == 1 ? 256 : 16;
+    tile_y_ = dims_ == 1 ? 1 : 16;
+    while (tile_x_ * tile_y_ > limit)
+    {
+        if (tile_y_ >= tile_x_ && tile_y_ > 1)
+        {
+            tile_y_ /= 2;
+        }
+        else
+        {
+            tile_x_ /= 2;
+        }  // end if
+    }  // end while
+    const cl::LocalSpaceArg tile = cl::Local(sizeof(Real) * (tile_x_ + 2) * (tile_y_ + 2));
+    apply_.setArg(6, tile);
+    sweep_.setArg(7, tile);
+}
+
+template <typename Real>
+void StencilOperator<Real>::enqueue_tiled(cl::CommandQueue& queue, cl::Kernel& kernel, const char* name)
+{
+    queue.enqueueNDRangeKernel(kernel,
+                               cl::NullRange,
+                               cl::NDRange(round_up(nx_, tile_x_), round_up(ny_, tile_y_), nz_),
+                               cl::NDRange(tile_x_, tile_y_, 1),
+                               nullptr,
+                               CLP_TRACE(name, nullptr));
+}
+
+template <typename Real>
+void StencilOperator<Real>::apply(cl::CommandQueue& queue, const cl::Buffer& x, cl::Buffer& y)
+{
+    apply_.setArg(4, x);
+    apply_.setArg(5, y);
+    enqueue_tiled(queue, apply_, "cl_stencil_apply");
+}
+
+template <typename Real>
+void StencilOperator<Real>::diagonal(cl::CommandQueue& queue, cl::Buffer& d)
+{
+    diagonal_.setArg(2, d);
+    queue.enqueueNDRangeKernel(diagonal_,
+                               cl::NullRange,
+                               cl::NDRange(rows()),
+                               cl::NullRange,
+                               nullptr,
+                               CLP_TRACE("cl_stencil_diagonal", nullptr));
+}
+
+template <typename Real>
+void StencilOperator<Real>::jacobi_sweep(cl::CommandQueue& queue,
+                                         const cl::Buffer& b,
+                                         const cl::Buffer& x,
+                                         cl::Buffer& x_next)
+{
+    sweep_.setArg(4, b);
+    sweep_.setArg(5, x);
+    sweep_.setArg(6, x_next);
+    enqueue_tiled(queue, sweep_, "cl_stencil_jacobi");
+}
+
+template <typename Real>
+void StencilOperator<Real>::colour_sweep(cl::CommandQueue& queue,
+                                         const cl::Buffer& b,
+                                         cl::Buffer& x,
+                                         int colour,
+                                         double omega)
+{
+    sor_.setArg(4, b);
+    sor_.setArg(5, x);
+    sor_.setArg(6, colour);
+    sor_.setArg(7, static_cast<Real>(omega));
+
+    // Half the points of every grid row carry the colour
+    queue.enqueueNDRangeKernel(sor_,
+                               cl::NullRange,
+                               cl::NDRange((nx_ + 1) / 2, ny_, nz_),
+                               cl::NullRange,
+                               nullptr,
+                               CLP_TRACE("cl_stencil_sor", nullptr));
+}
+
+template <typename Real>
+void StencilOperator<Real>::residual_partials(cl::CommandQueue& queue,
+                                              const cl::Buffer& b,
+                                              const cl::Buffer& x,
+                                              cl::Buffer& partial_max,
+                                              cl::Buffer& partial_sq,
+                                              std::size_t local)
+{
+    residual_.setArg(4, b);
+    residual_.setArg(5, x);
+    residual_.setArg(6, partial_max);
+    residual_.setArg(7, partial_sq);
+    residual_.setArg(8, cl::Local(sizeof(Real) * local));
+    residual_.setArg(9, cl::Local(sizeof(Real) * local));
+    queue.enqueueNDRangeKernel(residual_,
+                               cl::NullRange,
+                               cl::NDRange(round_up(rows(), local)),
+                               cl::NDRange(local),
+                               nullptr,
+                               CLP_TRACE("cl_stencil_residual_partial", nullptr));
+}
+
+template <typename Real>
+void StencilOperator<Real>::jacobi_residual_sweep(cl::CommandQueue& queue,
+                                                  const cl::Buffer& b,
+                                                  const cl::Buffer& x,
+                                                  cl::Buffer& x_next,
+                                                  cl::Buffer& partial_max,
+                                                  cl::Buffer& partial_sq,
+                                                  std::size_t local)
+{
+    fused_.setArg(4, b);
+    fused_.setArg(5, x);
+    fused_.setArg(6, x_next);
+    fused_.setArg(7, partial_max);
+    fused_.setArg(8, partial_sq);
+    fused_.setArg(9, cl::Local(sizeof(Real) * local));
+    fused_.setArg(10, cl::Local(sizeof(Real) * local));
+    queue.enqueueNDRangeKernel(fused_,
+                               cl::NullRange,
+                               cl::NDRange(round_up(rows(), local)),
+                               cl::NDRange(local),
+                               nullptr,
+                               CLP_TRACE("cl_stencil_jacobi_residual", nullptr));
+}
+
+template <typename Real>
+std::size_t StencilOperator<Real>::residual_local_limit() const
+{
+    const cl::Device& device = Runtime::instance().device();
+    return std::min(residual_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device),
+                    fused_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device));
+}
+
+template class StencilOperator<float>;
+template class StencilOperator<double>;
+
+}  // namespace clp
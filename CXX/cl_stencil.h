@@ -0,0 +1,85 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Matrix-Free Stencil Operators
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Operators for the diffusion (Poisson) problem on structured grids	*
+ * 	that never store the matrix: the 3-point (1-D), 5-point (2-D) and	*
+ * 	7-point (3-D) negative Laplacian with Dirichlet boundaries is		*
+ * 	applied straight from the grid extents (cl_stencil.cl). The device	*
+ * 	holds only the vectors, so a 4096 x 4096 grid costs a few vectors	*
+ * 	of 16M scalars instead of a matrix.									*
+ *																		*
+ * 	The 1-D and 2-D operators equal tridiagonal_csr(n, -1, 2, -1) and	*
+ * 	poisson2d_csr(nx, ny) of cl_sparse.h; like them, unknowns are		*
+ * 	numbered x fastest. colour_sweep() uses the red-black ordering of	*
+ * 	the grid.															*
+ ************************************************************************/
+
+#ifndef CXX_CL_STENCIL_H
+#define CXX_CL_STENCIL_H
+
+#include "cl_operator.h"
+
+namespace clp
+{
+
+template <typename Real>
+class StencilOperator : public DeviceOperator
+{
+  public:
+    // nx points along x, and ny along y and nz along z for a 2-D or 3-D
+    // 	grid; 0 leaves the dimension out. Throws std::invalid_argument for
+    // 	an empty grid, or nz without ny
+    explicit StencilOperator(int nx, int ny = 0, int nz = 0);
+
+    int rows() const override { return nx_ * ny_ * nz_; }
+    std::size_t scalar_size() const override { return sizeof(Real); }
+    int dimensions() const { return dims_; }
+
+    void apply(cl::CommandQueue& queue, const cl::Buffer& x, cl::Buffer& y) override;
+    void diagonal(cl::CommandQueue& queue, cl::Buffer& d) override;
+    void jacobi_sweep(cl::CommandQueue& queue, const cl::Buffer& b, const cl::Buffer& x, cl::Buffer& x_next) override;
+    int colours() const override { return 2; }
+    void colour_sweep(cl::CommandQueue& queue, const cl::Buffer& b, cl::Buffer& x, int colour, double omega) override;
+    void residual_partials(cl::CommandQueue& queue,
+                           const cl::Buffer& b,
+                           const cl::Buffer& x,
+                           cl::Buffer& partial_max,
+                           cl::Buffer& partial_sq,
+                           std::size_t local) override;
+    void jacobi_residual_sweep(cl::CommandQueue& queue,
+                               const cl::Buffer& b,
+                               const cl::Buffer& x,
+                               cl::Buffer& x_next,
+                               cl::Buffer& partial_max,
+                               cl::Buffer& partial_sq,
+                               std::size_t local) override;
+    std::size_t residual_local_limit() const override;
+
+  private:
+    // Launches a halo-tiled kernel on the (tile_x, tile_y, 1) work-groups
+    void enqueue_tiled(cl::CommandQueue& queue, cl::Kernel& kernel, const char* name);
+
+    int nx_;
+    int ny_;
+    int nz_;
+    int dims_;
+    Real diag_;  // 2 * dims
+    cl::Kernel apply_;
+    cl::Kernel diagonal_;
+    cl::Kernel sweep_;
+    cl::Kernel sor_;
+    cl::Kernel residual_;
+    cl::Kernel fused_;
+    std::size_t tile_x_;
+    std::size_t tile_y_;
+};
+
+extern template class StencilOperator<float>;
+extern template class StencilOperator<double>;
+
+}  // namespace clp
+
+#endif  // CXX_CL_STENCIL_H
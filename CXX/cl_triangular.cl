@@ -0,0 +1,115 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Triangular Solve Kernels
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+* Triangular solves T X = B, many right-hand sides (cl_triangular.h)	*
+* 	B is row-major n x nrhs with leading dimension ldb and is			*
+* 	overwritten by X. "upper" selects the upper triangle of T, "unit"	*
+* 	an implicit unit diagonal.											*
+* 																		*
+* 	Dense T: cl_trsm_diag solves one nb x nb diagonal block, then		*
+* 	cl_trsm_update (or cl_gemm for many right-hand sides) removes it	*
+* 	from the remaining rows.											*
+* 	Sparse T: rows are grouped into levels that only depend on earlier	*
+* 	levels; cl_sptrsv_level solves all rows of one level at once.		*
+************************************************************************/
+
+#ifdef cl_khr_fp64
+#pragma OPENCL EXTENSION cl_khr_fp64 : enable
+#endif
+
+/************************************************************************
+* Dense Diagonal Block 													*
+************************************************************************/
+// One work-group per right-hand side (dimension 1), one work-item per row
+// 	of the block (local size >= nb). The block of X lives in local memory;
+// 	row i is finished by its owner, then every later row takes its share
+// 	in parallel, one barrier per row.
+__kernel void cl_trsm_diag(int nb, int upper, int unit, const __global double *A, int offA, int lda,
+							__global double *B, int offB, int ldb, __local double *xs){
+	int j   = get_local_id(0);
+	int rhs = get_global_id(1);
+
+	//[A]:Load this column of the block
+	if (j < nb){
+		xs[j] = B[offB + rhs + ldb*j];
+	}/*end if*/
+	barrier(CLK_LOCAL_MEM_FENCE);
+
+	//[B]:Substitution, bottom up for an upper triangle
+	int s;
+	for (s = 0; s < nb; s++){
+		int i = upper ? nb - 1 - s : s;
+		if (j == i && !unit){
+			xs[i] /= A[offA + i + lda*i];
+		}/*end if*/
+		barrier(CLK_LOCAL_MEM_FENCE);
+
+		if (j < nb && (upper ? j < i : j > i)){
+			xs[j] -= A[offA + i + lda*j]*xs[i];
+		}/*end if*/
+	}/*end s*/
+
+	//[C]:Each row was last written by its own work-item
+	if (j < nb){
+		B[offB + rhs + ldb*j] = xs[j];
+	}/*end if*/
+}
+
+
+/************************************************************************
+* Dense Update 															*
+************************************************************************/
+// B[row] -= A[row, 0..kb) X for m rows: a GEMV per right-hand side, one
+// 	work-item per (row, rhs). A, X and B are sub-blocks (element offsets)
+// 	of the same or different buffers; the rows of B and X never overlap.
+__kernel void cl_trsm_update(int m, int nrhs, int kb, const __global double *A, int offA, int lda,
+							const __global double *X, int offX, __global double *B, int offB, int ldb){
+	int row = get_global_id(0);
+	int rhs = get_global_id(1);
+	if (row >= m || rhs >= nrhs){
+		return;
+	}/*end if*/
+
+	double sum = 0.0;
+	int p;
+	for (p = 0; p < kb; p++){
+		sum += A[offA + p + lda*row]*X[offX + rhs + ldb*p];
+	}/*end p*/
+	B[offB + rhs + ldb*row] -= sum;
+}
+
+
+/************************************************************************
+* Sparse Level 															*
+************************************************************************/
+// Solves the rows level_rows[first .. first+count) of a CSR matrix, one
+// 	work-item per (row, rhs). Only entries of the selected triangle are
+// 	used, so T may also hold both factors (e.g. an incomplete LU).
+__kernel void cl_sptrsv_level(int first, int count, int nrhs, int upper, int unit,
+							const __global int *level_rows, const __global int *row_ptr,
+							const __global int *col_idx, const __global double *values,
+							__global double *B, int ldb){
+	int r   = get_global_id(0);
+	int rhs = get_global_id(1);
+	if (r >= count || rhs >= nrhs){
+		return;
+	}/*end if*/
+
+	int row     = level_rows[first + r];
+	double sum  = B[rhs + ldb*row];
+	double diag = 1.0;
+	int p;
+	for (p = row_ptr[row]; p < row_ptr[row+1]; p++){
+		int col = col_idx[p];
+		if (col == row){
+			diag = values[p];
+		}
+		else if (upper ? col > row : col < row){
+			sum -= values[p]*B[rhs + ldb*col];
+		}/*end if*/
+	}/*end p*/
+	B[rhs + ldb*row] = unit ? sum : sum/diag;
+}
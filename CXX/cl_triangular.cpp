@@ -0,0 +1,308 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Triangular Solves
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_triangular.h"
+#include "cl_profiler.h"
+#include "host_blas.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace clp
+{
+namespace
+{
+
+// From this many right-hand sides on, the dense update is a tiled GEMM
+// 	rather than one GEMV per right-hand side
+const int kGemmRhs = 16;
+
+// Rows per thread below which a level of sptrsm stays serial
+const int kMinLevelRows = 64;
+
+template <typename T>
+cl::Buffer device_copy(const std::vector<T>& host)
+{
+    return cl::Buffer(Runtime::instance().context(),
+                      CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                      sizeof(T) * host.size(),
+                      const_cast<T*>(host.data()));
+}
+
+bool in_triangle(int row, int col, Triangle uplo)
+{
+    return uplo == Triangle::Lower ? col < row : col > row;
+}
+
+void require_triangular_factor(const CsrMatrix& T, bool unit_diag, const char* who)
+{
+    if (T.rows != T.cols)
+    {
+        throw std::invalid_argument(std::string(who) + ": the matrix must be square");
+    }
+    if (unit_diag)
+    {
+        return;
+    }
+    for (int row = 0; row < T.rows; row++)
+    {
+        const int* first = T.col_idx.data() + T.row_ptr[row];
+        const int* last = T.col_idx.data() + T.row_ptr[row + 1];
+        if (std::find(first, last, row) == last)
+        {
+            throw std::invalid_argument(std::string(who) + ": no diagonal entry in row " + std::to_string(row));
+        }
+    }  // end row
+}
+
+}  // namespace
+
+/************************************************************************
+ * Level Scheduling														*
+ ************************************************************************/
+
+LevelSchedule level_schedule(const CsrMatrix& T, Triangle uplo)
+{
+    const int n = T.rows;
+    std::vector<int> level(n, 0);
+    int depth = 0;
+
+    // [A]:Level of each row, in dependency order
+    for (int step = 0; step < n; step++)
+    {
+        const int row = uplo == Triangle::Lower ? step : n - 1 - step;
+        int l = 0;
+        for (int p = T.row_ptr[row]; p < T.row_ptr[row + 1]; p++)
+        {
+            if (in_triangle(row, T.col_idx[p], uplo))
+            {
+                l = std::max(l, level[T.col_idx[p]] + 1);
+            }
+        }  // end p
+        level[row] = l;
+        depth = std::max(depth, l + 1);
+    }  // end step
+
+    // [B]:Counting sort by level, rows ascending within a level
+    LevelSchedule schedule;
+    schedule.level_ptr.assign(depth + 1, 0);
+    for (int row = 0; row < n; row++)
+    {
+        schedule.level_ptr[level[row] + 1]++;
+    }  // end row
+    for (int l = 0; l < depth; l++)
+    {
+        schedule.level_ptr[l + 1] += schedule.level_ptr[l];
+    }  // end l
+
+    schedule.rows.resize(n);
+    std::vector<int> next(schedule.level_ptr.begin(), schedule.level_ptr.end() - 1);
+    for (int row = 0; row < n; row++)
+    {
+        schedule.rows[next[level[row]]++] = row;
+    }  // end row
+    return schedule;
+}
+
+void sptrsm(const CsrMatrix& T,
+            Triangle uplo,
+            bool unit_diag,
+            const LevelSchedule& schedule,
+            int nrhs,
+            double* B,
+            int ldb,
+            host::ThreadPool& pool)
+{
+    require_triangular_factor(T, unit_diag, "sptrsm");
+    for (int l = 0; l < schedule.levels(); l++)
+    {
+        const int first = schedule.level_ptr[l];
+        pool.parallel_for(
+            schedule.level_ptr[l + 1] - first,
+            [&](int begin, int end) {
+                for (int r = first + begin; r < first + end; r++)
+                {
+                    const int row = schedule.rows[r];
+                    double diag = 1.0;
+                    for (int p = T.row_ptr[row]; p < T.row_ptr[row + 1]; p++)
+                    {
+                        const int col = T.col_idx[p];
+                        if (col == row)
+                        {
+                            diag = T.values[p];
+                        }
+                        else if (in_triangle(row, col, uplo))
+                        {
+                            host::axpy(nrhs, -T.values[p], B + ldb * col, B + ldb * row);
+                        }
+                    }  // end p
+                    if (!unit_diag)
+                    {
+                        host::scal(nrhs, 1.0 / diag, B + ldb * row);
+                    }
+                }  // end r
+            },
+            kMinLevelRows);
+    }  // end l
+}
+
+/************************************************************************
+ * Dense Device Solver													*
+ ************************************************************************/
+
+DenseTriangularSolver::DenseTriangularSolver(int block)
+{
+    if (block < 1)
+    {
+        throw std::invalid_argument("DenseTriangularSolver: block must be positive");
+    }
+    cl::Program program = build_program(load_kernel_source("cl_triangular.cl"));
+    diag_ = cl::Kernel(program, "cl_trsm_diag");
+    update_ = cl::Kernel(program, "cl_trsm_update");
+
+    // One work-item per row of a diagonal block
+    const std::size_t limit = diag_.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(Runtime::instance().device());
+    block_ = static_cast<int>(std::min<std::size_t>(block, limit));
+}
+
+void DenseTriangularSolver::solve(cl::CommandQueue& queue,
+                                  Triangle uplo,
+                                  bool unit_diag,
+                                  int n,
+                                  int nrhs,
+                                  const cl::Buffer& T,
+                                  int ldt,
+                                  cl::Buffer& B,
+                                  int ldb)
+{
+    if (n < 0 || nrhs < 0 || ldt < n || ldb < nrhs)
+    {
+        throw std::invalid_argument("DenseTriangularSolver: need n, nrhs >= 0, ldt >= n and ldb >= nrhs");
+    }
+    if (n == 0 || nrhs == 0)
+    {
+        return;
+    }
+    const bool upper = uplo == Triangle::Upper;
+    const bool use_gemm = nrhs >= kGemmRhs;
+    if (use_gemm && !gemm_)
+    {
+        gemm_.reset(new Dgemm(tuned_gemm_config<double>(n, nrhs, block_)));
+    }
+
+    // [A]:Arguments fixed for the whole solve
+    diag_.setArg(1, static_cast<int>(upper));
+    diag_.setArg(2, static_cast<int>(unit_diag));
+    diag_.setArg(3, T);
+    diag_.setArg(5, ldt);
+    diag_.setArg(6, B);
+    diag_.setArg(8, ldb);
+    diag_.setArg(9, cl::Local(sizeof(double) * block_));
+
+    update_.setArg(1, nrhs);
+    update_.setArg(3, T);
+    update_.setArg(5, ldt);
+    update_.setArg(6, B);
+    update_.setArg(8, B);
+    update_.setArg(10, ldb);
+
+    // [B]:Diagonal blocks in dependency order (last block first for upper)
+    for (int done = 0; done < n; done += block_)
+    {
+        const int k0 = upper ? std::max(0, n - done - block_) : done;
+        const int nb = upper ? n - done - k0 : std::min(block_, n - done);
+
+        diag_.setArg(0, nb);
+        diag_.setArg(4, k0 + ldt * k0);
+        diag_.setArg(7, ldb * k0);
+        queue.enqueueNDRangeKernel(diag_,
+                                   cl::NullRange,
+                                   cl::NDRange(block_, nrhs),
+                                   cl::NDRange(block_, 1),
+                                   nullptr,
+                                   CLP_TRACE("cl_trsm_diag", nullptr));
+
+        // [C]:Remove the solved block from the rows still to come
+        const int m = upper ? k0 : n - k0 - nb;
+        if (m == 0)
+        {
+            continue;
+        }
+        const int row0 = upper ? 0 : k0 + nb;
+        if (use_gemm)
+        {
+            (*gemm_)(queue, m, nrhs, nb, -1.0, T, k0 + ldt * row0, ldt, B, ldb * k0, ldb, 1.0, B, ldb * row0, ldb);
+        }
+        else
+        {
+            update_.setArg(0, m);
+            update_.setArg(2, nb);
+            update_.setArg(4, k0 + ldt * row0);
+            update_.setArg(7, ldb * k0);
+            update_.setArg(9, ldb * row0);
+            queue.enqueueNDRangeKernel(update_,
+                                       cl::NullRange,
+                                       cl::NDRange(m, nrhs),
+                                       cl::NullRange,
+                                       nullptr,
+                                       CLP_TRACE("cl_trsm_update", nullptr));
+        }
+    }  // end done
+}
+
+/************************************************************************
+ * Sparse Device Solver													*
+ ************************************************************************/
+
+SparseTriangularSolver::SparseTriangularSolver(const CsrMatrix& T, Triangle uplo, bool unit_diag)
+    : rows_(T.rows), schedule_(level_schedule(T, uplo))
+{
+    require_triangular_factor(T, unit_diag, "SparseTriangularSolver");
+    if (T.nnz() == 0)
+    {
+        throw std::invalid_argument("SparseTriangularSolver: the matrix has no nonzeros");
+    }
+
+    level_rows_ = device_copy(schedule_.rows);
+    row_ptr_ = device_copy(T.row_ptr);
+    col_idx_ = device_copy(T.col_idx);
+    values_ = device_copy(T.values);
+
+    level_ = cl::Kernel(build_program(load_kernel_source("cl_triangular.cl")), "cl_sptrsv_level");
+    level_.setArg(3, static_cast<int>(uplo == Triangle::Upper));
+    level_.setArg(4, static_cast<int>(unit_diag));
+    level_.setArg(5, level_rows_);
+    level_.setArg(6, row_ptr_);
+    level_.setArg(7, col_idx_);
+    level_.setArg(8, values_);
+}
+
+void SparseTriangularSolver::solve(cl::CommandQueue& queue, int nrhs, cl::Buffer& B, int ldb)
+{
+    if (nrhs <= 0)
+    {
+        return;
+    }
+    level_.setArg(2, nrhs);
+    level_.setArg(9, B);
+    level_.setArg(10, ldb);
+
+    // One launch per level; the in-order queue keeps the levels in sequence
+    for (int l = 0; l < schedule_.levels(); l++)
+    {
+        const int first = schedule_.level_ptr[l];
+        const int count = schedule_.level_ptr[l + 1] - first;
+        level_.setArg(0, first);
+        level_.setArg(1, count);
+        queue.enqueueNDRangeKernel(level_,
+                                   cl::NullRange,
+                                   cl::NDRange(count, nrhs),
+                                   cl::NullRange,
+                                   nullptr,
+                                   CLP_TRACE("cl_sptrsv_level", nullptr));
+    }  // end l
+}
+
+}  // namespace clp
@@ -0,0 +1,126 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Triangular Solves
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Parallel triangular solves T X = B for many right-hand sides at once	*
+ * 	(B is row-major n x nrhs and is overwritten by X), replacing the	*
+ * 	serial backsub/forwardsub of mylib.h once a factorization is done.	*
+ *																		*
+ * 	Dense T:  blocked, a small solve of each diagonal block followed by	*
+ * 			  a GEMV (few right-hand sides) or GEMM update of the rest.	*
+ * 			  Host version: clp::host::trsm_lower/trsm_upper.			*
+ * 	Sparse T: level scheduled. Rows are grouped into levels that only	*
+ * 			  depend on rows of earlier levels, and each level is		*
+ * 			  solved in parallel: one kernel launch (device) or one		*
+ * 			  parallel_for (host) per level.							*
+ ************************************************************************/
+
+#ifndef CXX_CL_TRIANGULAR_H
+#define CXX_CL_TRIANGULAR_H
+
+#include "cl_gemm.h"
+#include "cl_runtime.h"
+#include "cl_sparse.h"
+#include "host_thread_pool.h"
+#include <memory>
+#include <vector>
+
+namespace clp
+{
+
+enum class Triangle
+{
+    Lower = 0,
+    Upper = 1
+};
+
+/************************************************************************
+ * Level Scheduling														*
+ ************************************************************************/
+
+// Level l holds rows[level_ptr[l] .. level_ptr[l+1]); a row's level is one
+// 	more than the deepest row it references in the chosen triangle
+struct LevelSchedule
+{
+    std::vector<int> level_ptr;
+    std::vector<int> rows;
+
+    int levels() const { return static_cast<int>(level_ptr.size()) - 1; }
+};
+
+// Only entries of the "uplo" triangle of T are considered, so T may hold
+// 	both factors of an incomplete LU
+LevelSchedule level_schedule(const CsrMatrix& T, Triangle uplo);
+
+// Host solve of T X = B in place, B n x nrhs with leading dimension ldb.
+// 	Rows of one level are split over the pool
+void sptrsm(const CsrMatrix& T,
+            Triangle uplo,
+            bool unit_diag,
+            const LevelSchedule& schedule,
+            int nrhs,
+            double* B,
+            int ldb,
+            host::ThreadPool& pool = host::ThreadPool::instance());
+
+/************************************************************************
+ * Device Solvers														*
+ ************************************************************************/
+
+class DenseTriangularSolver
+{
+  public:
+    // block: rows per diagonal block, capped by the device work-group size
+    explicit DenseTriangularSolver(int block = 64);
+
+    // Solves T X = B in place. T is the "uplo" triangle of the n x n matrix
+    // 	in T_buf (leading dimension ldt); B is n x nrhs (leading dimension
+    // 	ldb). Both stay on the device, so repeated solves with the same
+    // 	factor only move the right-hand sides
+    void solve(cl::CommandQueue& queue,
+               Triangle uplo,
+               bool unit_diag,
+               int n,
+               int nrhs,
+               const cl::Buffer& T,
+               int ldt,
+               cl::Buffer& B,
+               int ldb);
+
+    int block() const { return block_; }
+
+  private:
+    int block_;
+    cl::Kernel diag_;
+    cl::Kernel update_;
+    std::unique_ptr<Dgemm> gemm_;  // Created on the first solve with many right-hand sides
+};
+
+class SparseTriangularSolver
+{
+  public:
+    // Copies T (square, with a diagonal entry in every row unless
+    // 	unit_diag) and its level schedule to the device
+    SparseTriangularSolver(const CsrMatrix& T, Triangle uplo, bool unit_diag = false);
+
+    // Solves T X = B in place, B n x nrhs with leading dimension ldb
+    void solve(cl::CommandQueue& queue, int nrhs, cl::Buffer& B, int ldb);
+
+    int rows() const { return rows_; }
+    const LevelSchedule& schedule() const { return schedule_; }
+
+  private:
+    int rows_;
+    LevelSchedule schedule_;
+    cl::Kernel level_;
+    cl::Buffer level_rows_;
+    cl::Buffer row_ptr_;
+    cl::Buffer col_idx_;
+    cl::Buffer values_;
+};
+
+}  // namespace clp
+
+#endif  // CXX_CL_TRIANGULAR_H
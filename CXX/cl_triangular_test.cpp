@@ -0,0 +1,197 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Triangular Solve Tests
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "cl_triangular.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+namespace
+{
+
+bool in_triangle(int row, int col, clp::Triangle uplo)
+{
+    return uplo == clp::Triangle::Lower ? col < row : col > row;
+}
+
+// Every row scheduled once, each level strictly after every row it reads
+// 	and as early as that allows
+void expect_valid_schedule(const clp::CsrMatrix& T, clp::Triangle uplo, const clp::LevelSchedule& schedule)
+{
+    ASSERT_EQ(schedule.level_ptr.front(), 0);
+    ASSERT_EQ(schedule.level_ptr.back(), T.rows);
+    ASSERT_EQ(static_cast<int>(schedule.rows.size()), T.rows);
+
+    std::vector<int> level(T.rows, -1);
+    for (int l = 0; l < schedule.levels(); l++)
+    {
+        EXPECT_LT(schedule.level_ptr[l], schedule.level_ptr[l + 1]) << "level " << l << " is empty";
+        for (int k = schedule.level_ptr[l]; k < schedule.level_ptr[l + 1]; k++)
+        {
+            ASSERT_EQ(level[schedule.rows[k]], -1) << "row " << schedule.rows[k] << " scheduled twice";
+            level[schedule.rows[k]] = l;
+        }  // end k
+    }  // end l
+
+    for (int row = 0; row < T.rows; row++)
+    {
+        int earliest = 0;
+        for (int p = T.row_ptr[row]; p < T.row_ptr[row + 1]; p++)
+        {
+            if (in_triangle(row, T.col_idx[p], uplo))
+            {
+                EXPECT_GT(level[row], level[T.col_idx[p]]) << "row " << row << " reads " << T.col_idx[p];
+                earliest = std::max(earliest, level[T.col_idx[p]] + 1);
+            }
+        }  // end p
+        EXPECT_EQ(level[row], earliest) << "row " << row;
+    }  // end row
+}
+
+// Both triangles of an irregular sparse matrix with a dominant diagonal
+clp::CsrMatrix test_matrix(int n)
+{
+    clp::CsrMatrix A;
+    A.rows = n;
+    A.cols = n;
+    A.row_ptr.push_back(0);
+    for (int i = 0; i < n; i++)
+    {
+        std::map<int, double> row;
+        row[i] = 4.0 + (i % 7);
+        row[(i * 5 + 3) % n] += 0.5;
+        row[static_cast<int>((static_cast<long long>(i) * i + 1) % n)] -= 0.25;
+        for (const auto& entry : row)
+        {
+            if (entry.second != 0.0)
+            {
+                A.col_idx.push_back(entry.first);
+                A.values.push_back(entry.second);
+            }
+        }  // end entry
+        A.row_ptr.push_back(A.nnz());
+    }  // end i
+    return A;
+}
+
+// Serial forward or back substitution of one column, the reference
+std::vector<double> substitute(const clp::CsrMatrix& T, clp::Triangle uplo, bool unit_diag, std::vector<double> b)
+{
+    const int n = T.rows;
+    for (int step = 0; step < n; step++)
+    {
+        const int row = uplo == clp::Triangle::Lower ? step : n - 1 - step;
+        double diag = 1.0;
+        for (int p = T.row_ptr[row]; p < T.row_ptr[row + 1]; p++)
+        {
+            if (T.col_idx[p] == row)
+            {
+                diag = T.values[p];
+            }
+            else if (in_triangle(row, T.col_idx[p], uplo))
+            {
+                b[row] -= T.values[p] * b[T.col_idx[p]];
+            }
+        }  // end p
+        if (!unit_diag)
+        {
+            b[row] /= diag;
+        }
+    }  // end step
+    return b;
+}
+
+}  // namespace
+
+/************************************************************************
+ * Level Scheduling														*
+ ************************************************************************/
+
+TEST(TriangularTest, BidiagonalIsOneRowPerLevel)
+{
+    const clp::CsrMatrix T = clp::tridiagonal_csr(12, -1.0, 2.0, -1.0);
+    for (clp::Triangle uplo : {clp::Triangle::Lower, clp::Triangle::Upper})
+    {
+        const clp::LevelSchedule schedule = clp::level_schedule(T, uplo);
+        EXPECT_EQ(schedule.levels(), T.rows);
+        expect_valid_schedule(T, uplo, schedule);
+    }  // end uplo
+}
+
+TEST(TriangularTest, DiagonalIsOneLevel)
+{
+    std::vector<double> dense(9 * 9, 0.0);
+    for (int i = 0; i < 9; i++)
+    {
+        dense[i + 9 * i] = 3.0;
+    }  // end i
+    const clp::CsrMatrix D = clp::csr_from_dense(dense.data(), 9, 9);
+    const clp::LevelSchedule schedule = clp::level_schedule(D, clp::Triangle::Lower);
+    EXPECT_EQ(schedule.levels(), 1);
+    expect_valid_schedule(D, clp::Triangle::Lower, schedule);
+}
+
+TEST(TriangularTest, IrregularScheduleOnlyReadsItsTriangle)
+{
+    // Both factors live in one matrix, as for an incomplete LU
+    const clp::CsrMatrix A = test_matrix(60);
+    for (clp::Triangle uplo : {clp::Triangle::Lower, clp::Triangle::Upper})
+    {
+        expect_valid_schedule(A, uplo, clp::level_schedule(A, uplo));
+    }  // end uplo
+
+    const clp::CsrMatrix P = clp::poisson2d_csr(9, 7);
+    const clp::LevelSchedule wavefront = clp::level_schedule(P, clp::Triangle::Lower);
+    EXPECT_EQ(wavefront.levels(), 9 + 7 - 1);  // Anti-diagonals of the grid
+    expect_valid_schedule(P, clp::Triangle::Lower, wavefront);
+}
+
+/************************************************************************
+ * Host Solve															*
+ ************************************************************************/
+
+TEST(TriangularTest, SptrsmMatchesSubstitution)
+{
+    // Wide enough levels to split over the pool
+    const int n = 3000;
+    const int nrhs = 3;
+    const clp::CsrMatrix A = test_matrix(n);
+
+    for (int threads : {1, 2, 5})
+    {
+        clp::host::ThreadPool pool(threads);
+        for (clp::Triangle uplo : {clp::Triangle::Lower, clp::Triangle::Upper})
+        {
+            for (bool unit_diag : {false, true})
+            {
+                SCOPED_TRACE(::testing::Message() << "threads " << threads << ", upper "
+                                                  << (uplo == clp::Triangle::Upper) << ", unit " << unit_diag);
+                std::vector<double> B(static_cast<std::size_t>(n) * nrhs);
+                for (std::size_t i = 0; i < B.size(); i++)
+                {
+                    B[i] = std::sin(0.1 * static_cast<double>(i)) + 1.0;
+                }  // end i
+                std::vector<double> X = B;
+                clp::sptrsm(A, uplo, unit_diag, clp::level_schedule(A, uplo), nrhs, X.data(), nrhs, pool);
+
+                for (int c = 0; c < nrhs; c++)
+                {
+                    std::vector<double> b(n);
+                    for (int i = 0; i < n; i++)
+                    {
+                        b[i] = B[c + nrhs * i];
+                    }  // end i
+                    const std::vector<double> x = substitute(A, uplo, unit_diag, b);
+                    for (int i = 0; i < n; i++)
+                    {
+                        EXPECT_NEAR(X[c + nrhs * i], x[i], 1e-12 * (1.0 + std::fabs(x[i]))) << "row " << i;
+                    }  // end i
+                }  // end c
+            }  // end unit_diag
+        }  // end uplo
+    }  // end threads
+}
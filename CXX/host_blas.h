@@ -0,0 +1,633 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Host BLAS
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Header-only host kernels for the CPU fallback and for verification,	*
+ * 	replacing the scalar loops of mylib.h. All matrices are row-major	*
+ * 	double with an explicit leading dimension (row stride), so the		*
+ * 	routines also work on sub-blocks of a larger matrix.				*
+ *																		*
+ * 	BLAS-1: dot, axpy, scal, amax										*
+ * 	BLAS-2: gemv, trsv_lower, trsv_upper									*
+ * 	BLAS-3: gemm (cache blocked, register blocked micro kernel),		*
+ * 			trsm_lower, trsm_upper (blocked, many right-hand sides)		*
+ * 	LAPACK: lu_inplace (unpivoted Doolittle, in place)					*
+ *																		*
+ * 	The inner kernels come in scalar, AVX2+FMA and AVX-512 flavours.	*
+ * 	The widest one the CPU supports is picked once at run time, so one	*
+ * 	binary runs on every node. CLP_HOST_ISA = scalar | avx2 | avx512	*
+ * 	caps the choice (e.g. to compare paths).							*
+ ************************************************************************/
+
+#ifndef CXX_HOST_BLAS_H
+#define CXX_HOST_BLAS_H
+
+#include <algorithm>
+#include <cmath>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CLP_HOST_BLAS_X86 1
+#include <immintrin.h>
+#else
+#define CLP_HOST_BLAS_X86 0
+#endif
+
+namespace clp
+{
+namespace host
+{
+
+/************************************************************************
+ * Instruction Set Dispatch												*
+ ************************************************************************/
+
+enum class Isa
+{
+    Scalar = 0,
+    Avx2 = 1,
+    Avx512 = 2
+};
+
+inline const char* isa_name(Isa isa)
+{
+    return isa == Isa::Avx512 ? "avx512" : (isa == Isa::Avx2 ? "avx2" : "scalar");
+}
+
+// Widest instruction set supported by both the CPU and CLP_HOST_ISA
+inline Isa detect_isa()
+{
+    Isa isa = Isa::Scalar;
+#if CLP_HOST_BLAS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        isa = Isa::Avx2;
+    }
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        isa = Isa::Avx512;
+    }
+#endif
+
+    const char* cap = getenv("CLP_HOST_ISA");
+    if (cap && strcmp(cap, "scalar") == 0)
+    {
+        isa = Isa::Scalar;
+    }
+    else if (cap && strcmp(cap, "avx2") == 0)
+    {
+        isa = std::min(isa, Isa::Avx2);
+    }
+    return isa;
+}
+
+namespace detail
+{
+
+// Block sizes of gemm: a KB x NB panel of B (256 KB) stays in L2 while
+// 	MB rows of A stream through it
+const int kGemmMB = 64;
+const int kGemmKB = 128;
+const int kGemmNB = 256;
+
+// Diagonal block of trsm_lower/trsm_upper; the rest of the solve is gemm
+const int kTrsmNB = 64;
+
+/************************************************************************
+ * Scalar Kernels														*
+ ************************************************************************/
+
+inline double dot_scalar(int n, const double* x, const double* y)
+{
+    double sum = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        sum += x[i] * y[i];
+    }  // end i
+    return sum;
+}
+
+inline void axpy_scalar(int n, double alpha, const double* x, double* y)
+{
+    for (int i = 0; i < n; i++)
+    {
+        y[i] += alpha * x[i];
+    }  // end i
+}
+
+// C[0:mb, 0:nb] += alpha * A[0:mb, 0:kb] * B[0:kb, 0:nb]
+inline void gemm_block_scalar(int mb,
+                              int nb,
+                              int kb,
+                              double alpha,
+                              const double* A,
+                              int lda,
+                              const double* B,
+                              int ldb,
+                              double* C,
+                              int ldc)
+{
+    for (int i = 0; i < mb; i++)
+    {
+        for (int k = 0; k < kb; k++)
+        {
+            axpy_scalar(nb, alpha * A[k + lda * i], B + ldb * k, C + ldc * i);
+        }  // end k
+    }  // end i
+}
+
+#if CLP_HOST_BLAS_X86
+
+/************************************************************************
+ * AVX2 + FMA Kernels													*
+ ************************************************************************/
+
+__attribute__((target("avx2,fma"))) inline double dot_avx2(int n, const double* x, const double* y)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+        acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), acc1);
+    }  // end i
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+    double sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; i++)
+    {
+        sum += x[i] * y[i];
+    }  // end i
+    return sum;
+}
+
+__attribute__((target("avx2,fma"))) inline void axpy_avx2(int n, double alpha, const double* x, double* y)
+{
+    const __m256d a = _mm256_set1_pd(alpha);
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+    }  // end i
+    for (; i < n; i++)
+    {
+        y[i] += alpha * x[i];
+    }  // end i
+}
+
+// 4 x 8 register tile: each k step loads one row slice of B and broadcasts
+// 	four entries of A into 8 FMAs
+__attribute__((target("avx2,fma"))) inline void gemm_block_avx2(int mb,
+                                                               int nb,
+                                                               int kb,
+                                                               double alpha,
+                                                               const double* A,
+                                                               int lda,
+                                                               const double* B,
+                                                               int ldb,
+                                                               double* C,
+                                                               int ldc)
+{
+    int i = 0;
+    for (; i + 4 <= mb; i += 4)
+    {
+        int j = 0;
+        for (; j + 8 <= nb; j += 8)
+        {
+            __m256d c[4][2];
+            for (int r = 0; r < 4; r++)
+            {
+                c[r][0] = _mm256_loadu_pd(C + j + ldc * (i + r));
+                c[r][1] = _mm256_loadu_pd(C + j + 4 + ldc * (i + r));
+            }  // end r
+            for (int k = 0; k < kb; k++)
+            {
+                const __m256d b0 = _mm256_loadu_pd(B + j + ldb * k);
+                const __m256d b1 = _mm256_loadu_pd(B + j + 4 + ldb * k);
+                for (int r = 0; r < 4; r++)
+                {
+                    const __m256d a = _mm256_set1_pd(alpha * A[k + lda * (i + r)]);
+                    c[r][0] = _mm256_fmadd_pd(a, b0, c[r][0]);
+                    c[r][1] = _mm256_fmadd_pd(a, b1, c[r][1]);
+                }  // end r
+            }  // end k
+            for (int r = 0; r < 4; r++)
+            {
+                _mm256_storeu_pd(C + j + ldc * (i + r), c[r][0]);
+                _mm256_storeu_pd(C + j + 4 + ldc * (i + r), c[r][1]);
+            }  // end r
+        }  // end j
+
+        // Column edge
+        if (j < nb)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                for (int k = 0; k < kb; k++)
+                {
+                    axpy_avx2(nb - j, alpha * A[k + lda * (i + r)], B + j + ldb * k, C + j + ldc * (i + r));
+                }  // end k
+            }  // end r
+        }
+    }  // end i
+
+    // Row edge
+    for (; i < mb; i++)
+    {
+        for (int k = 0; k < kb; k++)
+        {
+            axpy_avx2(nb, alpha * A[k + lda * i], B + ldb * k, C + ldc * i);
+        }  // end k
+    }  // end i
+}
+
+/************************************************************************
+ * AVX-512 Kernels														*
+ ************************************************************************/
+
+__attribute__((target("avx512f"))) inline double dot_avx512(int n, const double* x, const double* y)
+{
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), acc0);
+        acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8), acc1);
+    }  // end i
+    double lanes[8];
+    _mm512_storeu_pd(lanes, _mm512_add_pd(acc0, acc1));
+    double sum = 0.0;
+    for (int l = 0; l < 8; l++)
+    {
+        sum += lanes[l];
+    }  // end l
+    for (; i < n; i++)
+    {
+        sum += x[i] * y[i];
+    }  // end i
+    return sum;
+}
+
+__attribute__((target("avx512f"))) inline void axpy_avx512(int n, double alpha, const double* x, double* y)
+{
+    const __m512d a = _mm512_set1_pd(alpha);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    }  // end i
+    if (i < n)
+    {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512d yi = _mm512_maskz_loadu_pd(mask, y + i);
+        _mm512_mask_storeu_pd(y + i, mask, _mm512_fmadd_pd(a, _mm512_maskz_loadu_pd(mask, x + i), yi));
+    }
+}
+
+// 4 x 16 register tile, same scheme as gemm_block_avx2
+__attribute__((target("avx512f"))) inline void gemm_block_avx512(int mb,
+                                                                int nb,
+                                                                int kb,
+                                                                double alpha,
+                                                                const double* A,
+                                                                int lda,
+                                                                const double* B,
+                                                                int ldb,
+                                                                double* C,
+                                                                int ldc)
+{
+    int i = 0;
+    for (; i + 4 <= mb; i += 4)
+    {
+        int j = 0;
+        for (; j + 16 <= nb; j += 16)
+        {
+            __m512d c[4][2];
+            for (int r = 0; r < 4; r++)
+            {
+                c[r][0] = _mm512_loadu_pd(C + j + ldc * (i + r));
+                c[r][1] = _mm512_loadu_pd(C + j + 8 + ldc * (i + r));
+            }  // end r
+            for (int k = 0; k < kb; k++)
+            {
+                const __m512d b0 = _mm512_loadu_pd(B + j + ldb * k);
+                const __m512d b1 = _mm512_loadu_pd(B + j + 8 + ldb * k);
+                for (int r = 0; r < 4; r++)
+                {
+                    const __m512d a = _mm512_set1_pd(alpha * A[k + lda * (i + r)]);
+                    c[r][0] = _mm512_fmadd_pd(a, b0, c[r][0]);
+                    c[r][1] = _mm512_fmadd_pd(a, b1, c[r][1]);
+                }  // end r
+            }  // end k
+            for (int r = 0; r < 4; r++)
+            {
+                _mm512_storeu_pd(C + j + ldc * (i + r), c[r][0]);
+                _mm512_storeu_pd(C + j + 8 + ldc * (i + r), c[r][1]);
+            }  // end r
+        }  // end j
+
+        // Column edge
+        if (j < nb)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                for (int k = 0; k < kb; k++)
+                {
+                    axpy_avx512(nb - j, alpha * A[k + lda * (i + r)], B + j + ldb * k, C + j + ldc * (i + r));
+                }  // end k
+            }  // end r
+        }
+    }  // end i
+
+    // Row edge
+    for (; i < mb; i++)
+    {
+        for (int k = 0; k < kb; k++)
+        {
+            axpy_avx512(nb, alpha * A[k + lda * i], B + ldb * k, C + ldc * i);
+        }  // end k
+    }  // end i
+}
+
+#endif  // CLP_HOST_BLAS_X86
+
+/************************************************************************
+ * Dispatch Table														*
+ ************************************************************************/
+
+struct Kernels
+{
+    Isa isa;
+    double (*dot)(int, const double*, const double*);
+    void (*axpy)(int, double, const double*, double*);
+    void (*gemm_block)(int, int, int, double, const double*, int, const double*, int, double*, int);
+};
+
+inline Kernels select_kernels(Isa isa)
+{
+#if CLP_HOST_BLAS_X86
+    if (isa == Isa::Avx512)
+    {
+        return Kernels{isa, dot_avx512, axpy_avx512, gemm_block_avx512};
+    }
+    if (isa == Isa::Avx2)
+    {
+        return Kernels{isa, dot_avx2, axpy_avx2, gemm_block_avx2};
+    }
+#endif
+    return Kernels{Isa::Scalar, dot_scalar, axpy_scalar, gemm_block_scalar};
+}
+
+// Chosen once per process
+inline const Kernels& kernels()
+{
+    static const Kernels table = select_kernels(detect_isa());
+    return table;
+}
+
+}  // namespace detail
+
+// Instruction set the kernels run with in this process
+inline Isa active_isa()
+{
+    return detail::kernels().isa;
+}
+
+/************************************************************************
+ * BLAS-1																*
+ ************************************************************************/
+
+// x . y
+inline double dot(int n, const double* x, const double* y)
+{
+    return detail::kernels().dot(n, x, y);
+}
+
+// y += alpha * x
+inline void axpy(int n, double alpha, const double* x, double* y)
+{
+    detail::kernels().axpy(n, alpha, x, y);
+}
+
+// x *= alpha
+inline void scal(int n, double alpha, double* x)
+{
+    for (int i = 0; i < n; i++)
+    {
+        x[i] *= alpha;
+    }  // end i
+}
+
+// max |x_i| (0 for n = 0)
+inline double amax(int n, const double* x)
+{
+    double value = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        value = std::max(value, std::fabs(x[i]));
+    }  // end i
+    return value;
+}
+
+/************************************************************************
+ * BLAS-2																*
+ ************************************************************************/
+
+// y = alpha * A x + beta * y, A is m x n
+inline void gemv(int m, int n, double alpha, const double* A, int lda, const double* x, double beta, double* y)
+{
+    for (int i = 0; i < m; i++)
+    {
+        const double ax = dot(n, A + lda * i, x);
+        y[i] = alpha * ax + (beta == 0.0 ? 0.0 : beta * y[i]);
+    }  // end i
+}
+
+// Solves L x = b in place (x holds b on entry). L is the lower triangle of
+// 	A, with an implicit unit diagonal when unit_diag is set
+inline void trsv_lower(int n, const double* A, int lda, double* x, bool unit_diag = false)
+{
+    for (int i = 0; i < n; i++)
+    {
+        const double sum = x[i] - dot(i, A + lda * i, x);
+        x[i] = unit_diag ? sum : sum / A[i + lda * i];
+    }  // end i
+}
+
+// Solves U x = b in place (x holds b on entry). U is the upper triangle of A
+inline void trsv_upper(int n, const double* A, int lda, double* x)
+{
+    for (int i = n - 1; i >= 0; i--)
+    {
+        const double sum = x[i] - dot(n - 1 - i, A + (i + 1) + lda * i, x + i + 1);
+        x[i] = sum / A[i + lda * i];
+    }  // end i
+}
+
+/************************************************************************
+ * BLAS-3																*
+ ************************************************************************/
+
+// C = alpha * A B + beta * C with A m x k, B k x n, C m x n
+inline void gemm(int m,
+                 int n,
+                 int k,
+                 double alpha,
+                 const double* A,
+                 int lda,
+                 const double* B,
+                 int ldb,
+                 double beta,
+                 double* C,
+                 int ldc)
+{
+    // [A]:C = beta * C (beta = 0 overwrites, so C may start uninitialised)
+    for (int i = 0; i < m; i++)
+    {
+        if (beta == 0.0)
+        {
+            std::fill(C + ldc * i, C + ldc * i + n, 0.0);
+        }
+        else if (beta != 1.0)
+        {
+            scal(n, beta, C + ldc * i);
+        }
+    }  // end i
+    if (alpha == 0.0 || k == 0)
+    {
+        return;
+    }
+
+    // [B]:Blocked accumulation, B panels outermost so they stay in cache
+    const detail::Kernels& kern = detail::kernels();
+    for (int j0 = 0; j0 < n; j0 += detail::kGemmNB)
+    {
+        const int nb = std::min(detail::kGemmNB, n - j0);
+        for (int k0 = 0; k0 < k; k0 += detail::kGemmKB)
+        {
+            const int kb = std::min(detail::kGemmKB, k - k0);
+            for (int i0 = 0; i0 < m; i0 += detail::kGemmMB)
+            {
+                const int mb = std::min(detail::kGemmMB, m - i0);
+                kern.gemm_block(mb,
+                                nb,
+                                kb,
+                                alpha,
+                                A + k0 + lda * i0,
+                                lda,
+                                B + j0 + ldb * k0,
+                                ldb,
+                                C + j0 + ldc * i0,
+                                ldc);
+            }  // end i0
+        }  // end k0
+    }  // end j0
+}
+
+// Solves L X = B in place for nrhs right-hand sides (B is n x nrhs and
+// 	holds X on return). L is the lower triangle of A, with an implicit
+// 	unit diagonal when unit_diag is set. Blocked: a small solve of each
+// 	diagonal block, then a gemm update of the rows below it
+inline void trsm_lower(int n, int nrhs, const double* A, int lda, double* B, int ldb, bool unit_diag = false)
+{
+    if (nrhs == 1 && ldb == 1)
+    {
+        trsv_lower(n, A, lda, B, unit_diag);
+        return;
+    }
+    for (int k0 = 0; k0 < n; k0 += detail::kTrsmNB)
+    {
+        const int nb = std::min(detail::kTrsmNB, n - k0);
+
+        // [A]:Diagonal block, one row of X at a time across all columns
+        for (int i = k0; i < k0 + nb; i++)
+        {
+            for (int p = k0; p < i; p++)
+            {
+                axpy(nrhs, -A[p + lda * i], B + ldb * p, B + ldb * i);
+            }  // end p
+            if (!unit_diag)
+            {
+                scal(nrhs, 1.0 / A[i + lda * i], B + ldb * i);
+            }
+        }  // end i
+
+        // [B]:B2 -= L21 X1
+        const int rest = n - k0 - nb;
+        if (rest > 0)
+        {
+            gemm(rest, nrhs, nb, -1.0, A + k0 + lda * (k0 + nb), lda, B + ldb * k0, ldb, 1.0, B + ldb * (k0 + nb), ldb);
+        }
+    }  // end k0
+}
+
+// Solves U X = B in place for nrhs right-hand sides, U being the upper
+// 	triangle of A; blocked like trsm_lower, from the last block up
+inline void trsm_upper(int n, int nrhs, const double* A, int lda, double* B, int ldb, bool unit_diag = false)
+{
+    if (nrhs == 1 && ldb == 1 && !unit_diag)
+    {
+        trsv_upper(n, A, lda, B);
+        return;
+    }
+    for (int k1 = n; k1 > 0; k1 -= detail::kTrsmNB)
+    {
+        const int k0 = std::max(0, k1 - detail::kTrsmNB);
+
+        // [A]:Diagonal block, bottom row first
+        for (int i = k1 - 1; i >= k0; i--)
+        {
+            for (int p = i + 1; p < k1; p++)
+            {
+                axpy(nrhs, -A[p + lda * i], B + ldb * p, B + ldb * i);
+            }  // end p
+            if (!unit_diag)
+            {
+                scal(nrhs, 1.0 / A[i + lda * i], B + ldb * i);
+            }
+        }  // end i
+
+        // [B]:B0 -= U01 X1 for the rows above
+        if (k0 > 0)
+        {
+            gemm(k0, nrhs, k1 - k0, -1.0, A + k0, lda, B + ldb * k0, ldb, 1.0, B, ldb);
+        }
+    }  // end k1
+}
+
+/************************************************************************
+ * LU Decomposition														*
+ ************************************************************************/
+
+// Doolittle LU without pivoting, in place: on return the strict lower
+// 	triangle of A holds L (unit diagonal implied) and the upper triangle
+// 	holds U. Returns the first row with a zero pivot, or -1
+inline int lu_inplace(int n, double* A, int lda)
+{
+    for (int k = 0; k < n; k++)
+    {
+        const double pivot = A[k + lda * k];
+        if (pivot == 0.0)
+        {
+            return k;
+        }
+        for (int i = k + 1; i < n; i++)
+        {
+            const double l = A[k + lda * i] / pivot;
+            A[k + lda * i] = l;
+            axpy(n - k - 1, -l, A + (k + 1) + lda * k, A + (k + 1) + lda * i);
+        }  // end i
+    }  // end k
+    return -1;
+}
+
+}  // namespace host
+}  // namespace clp
+
+#endif  // CXX_HOST_BLAS_H
@@ -0,0 +1,331 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Native Host Backend
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "host_kernels.h"
+#include "host_blas.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <stdio.h>
+
+namespace clp
+{
+namespace host
+{
+namespace
+{
+
+// One task's share of a reduction, alone on its cache line
+struct alignas(kCacheLine) Partial
+{
+    double max = 0.0;
+    double sum = 0.0;
+};
+
+// y = a*x + b*y
+void axpby(int n, double a, const double* x, double b, double* y, ThreadPool& pool)
+{
+    pool.parallel_for_stealing(
+        n,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; i++)
+            {
+                y[i] = a * x[i] + b * y[i];
+            }  // end i
+        },
+        kTaskItems,
+        cache_line_items<double>());
+}
+
+// z = r / d
+void scale(int n, const double* d, const double* r, double* z, ThreadPool& pool)
+{
+    pool.parallel_for_stealing(
+        n,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; i++)
+            {
+                z[i] = r[i] / d[i];
+            }  // end i
+        },
+        kTaskItems,
+        cache_line_items<double>());
+}
+
+// d = diag(A); 0 for rows without a stored diagonal
+void diagonal_csr(const CsrMatrix& A, double* d, ThreadPool& pool)
+{
+    pool.parallel_for_stealing(
+        A.rows,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; i++)
+            {
+                d[i] = 0.0;
+                for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+                {
+                    if (A.col_idx[p] == i)
+                    {
+                        d[i] = A.values[p];
+                    }
+                }  // end p
+            }  // end i
+        },
+        kTaskRows,
+        cache_line_items<double>());
+}
+
+}  // namespace
+
+/************************************************************************
+ * Kernels																*
+ ************************************************************************/
+
+void spmv_csr(const CsrMatrix& A, const double* x, double* y, ThreadPool& pool)
+{
+    pool.parallel_for_stealing(
+        A.rows,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; i++)
+            {
+                double sum = 0.0;
+                for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+                {
+                    sum += A.values[p] * x[A.col_idx[p]];
+                }  // end p
+                y[i] = sum;
+            }  // end i
+        },
+        kTaskRows,
+        cache_line_items<double>());
+}
+
+void jacobi_sweep_csr(const CsrMatrix& A, const double* b, const double* x, double* x_next, ThreadPool& pool)
+{
+    pool.parallel_for_stealing(
+        A.rows,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; i++)
+            {
+                double sum = 0.0;
+                double diag = 1.0;
+                for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+                {
+                    if (A.col_idx[p] == i)
+                    {
+                        diag = A.values[p];
+                    }
+                    else
+                    {
+                        sum += A.values[p] * x[A.col_idx[p]];
+                    }
+                }  // end p
+                x_next[i] = (b[i] - sum) / diag;
+            }  // end i
+        },
+        kTaskRows,
+        cache_line_items<double>());
+}
+
+Norms residual_csr(const CsrMatrix& A, const double* b, const double* x, ThreadPool& pool)
+{
+    // [A]:One partial max|r| and sum r^2 per task
+    std::vector<Partial> partials((A.rows + kTaskRows - 1) / kTaskRows);
+    pool.parallel_for_stealing(
+        A.rows,
+        [&](int begin, int end) {
+            Partial& partial = partials[begin / kTaskRows];
+            for (int i = begin; i < end; i++)
+            {
+                double r = b[i];
+                for (int p = A.row_ptr[i]; p < A.row_ptr[i + 1]; p++)
+                {
+                    r -= A.values[p] * x[A.col_idx[p]];
+                }  // end p
+                partial.max = std::max(partial.max, std::fabs(r));
+                partial.sum += r * r;
+            }  // end i
+        },
+        kTaskRows,
+        cache_line_items<double>());
+
+    // [B]:Tasks in order
+    Norms norms;
+    for (const Partial& partial : partials)
+    {
+        norms.inf = std::max(norms.inf, partial.max);
+        norms.two += partial.sum;
+    }  // end partial
+    norms.two = std::sqrt(norms.two);
+    return norms;
+}
+
+double parallel_dot(int n, const double* x, const double* y, ThreadPool& pool)
+{
+    std::vector<Partial> partials((n + kTaskItems - 1) / kTaskItems);
+    pool.parallel_for_stealing(
+        n,
+        [&](int begin, int end) { partials[begin / kTaskItems].sum = dot(end - begin, x + begin, y + begin); },
+        kTaskItems,
+        cache_line_items<double>());
+
+    double sum = 0.0;
+    for (const Partial& partial : partials)
+    {
+        sum += partial.sum;
+    }  // end partial
+    return sum;
+}
+
+void parallel_gemm(int m,
+                   int n,
+                   int k,
+                   double alpha,
+                   const double* A,
+                   int lda,
+                   const double* B,
+                   int ldb,
+                   double beta,
+                   double* C,
+                   int ldc,
+                   ThreadPool& pool)
+{
+    // Row blocks the height of the gemm cache block, so every task reuses
+    // 	its B panels as the serial gemm does
+    pool.parallel_for_stealing(
+        m,
+        [&](int begin, int end) {
+            gemm(end - begin, n, k, alpha, A + lda * begin, lda, B, ldb, beta, C + ldc * begin, ldc);
+        },
+        detail::kGemmMB);
+}
+
+/************************************************************************
+ * Solvers																*
+ ************************************************************************/
+
+SolveResult jacobi_solve(const CsrMatrix& A,
+                         const std::vector<double>& b,
+                         std::vector<double>& x,
+                         const JacobiOptions& options,
+                         ThreadPool& pool)
+{
+    if (options.method != StationaryMethod::Jacobi)
+    {
+        throw std::invalid_argument("host::jacobi_solve: only the Jacobi method runs natively");
+    }
+    require_diagonal(A, "host::jacobi_solve");
+    SolveResult result;
+    const int n = A.rows;
+    const int check_every = std::max(1, options.check_every);
+
+    // [A]:Ping-pong iterates
+    const AlignedVector<double> b_vec(b.begin(), b.end());
+    AlignedVector<double> cur(x.begin(), x.end());
+    AlignedVector<double> next(n);
+
+    int iter = 1;
+    double res = residual_csr(A, b_vec.data(), cur.data(), pool).get(options.norm);
+    if (options.verbose)
+    {
+        printf("iter = %d | %s Residual = %f\n", iter, norm_name(options.norm), res);
+    }
+
+    while (res > options.tol && iter < options.maxiter)
+    {
+        // [B]:Advance Iteration Counter and sweep
+        iter += 1;
+        jacobi_sweep_csr(A, b_vec.data(), cur.data(), next.data(), pool);
+        std::swap(cur, next);
+
+        // [C]:Residual every N sweeps
+        if (iter % check_every == 0 || iter == options.maxiter)
+        {
+            res = residual_csr(A, b_vec.data(), cur.data(), pool).get(options.norm);
+            if (options.verbose)
+            {
+                printf("iter = %d | %s Residual = %f\n", iter, norm_name(options.norm), res);
+            }
+        }  // end if
+    }  // end while
+
+    std::copy(cur.begin(), cur.end(), x.begin());
+    result.iterations = iter;
+    result.residual = res;
+    result.converged = res <= options.tol;
+    return result;
+}
+
+SolveResult cg_solve(const CsrMatrix& A,
+                     const std::vector<double>& b,
+                     std::vector<double>& x,
+                     const CgOptions& options,
+                     ThreadPool& pool)
+{
+    require_diagonal(A, "host::cg_solve");
+    SolveResult result;
+    const int n = A.rows;
+    const int check_every = std::max(1, options.check_every);
+
+    // [A]:r = b - Ax, z = M^-1 r, p = z with M = diag(A)
+    AlignedVector<double> x_vec(x.begin(), x.end());
+    AlignedVector<double> r(b.begin(), b.end());
+    AlignedVector<double> z(n);
+    AlignedVector<double> p(n);
+    AlignedVector<double> q(n);
+    AlignedVector<double> diag(n);
+    diagonal_csr(A, diag.data(), pool);
+    spmv_csr(A, x_vec.data(), q.data(), pool);
+    axpby(n, -1.0, q.data(), 1.0, r.data(), pool);
+    scale(n, diag.data(), r.data(), z.data(), pool);
+    std::copy(z.begin(), z.end(), p.begin());
+    double rz = parallel_dot(n, r.data(), z.data(), pool);
+    double res = std::sqrt(parallel_dot(n, r.data(), r.data(), pool));
+
+    int iter = 0;
+    if (options.verbose)
+    {
+        printf("iter = %d | L2 Residual = %f\n", iter, res);
+    }
+
+    while (res > options.tol && iter < options.maxiter)
+    {
+        // [B]:Step along p
+        iter += 1;
+        spmv_csr(A, p.data(), q.data(), pool);
+        const double alpha = rz / parallel_dot(n, p.data(), q.data(), pool);
+        axpby(n, alpha, p.data(), 1.0, x_vec.data(), pool);
+        axpby(n, -alpha, q.data(), 1.0, r.data(), pool);
+
+        // [C]:Residual check every N iterations
+        if (iter % check_every == 0 || iter == options.maxiter)
+        {
+            res = std::sqrt(parallel_dot(n, r.data(), r.data(), pool));
+            if (options.verbose)
+            {
+                printf("iter = %d | L2 Residual = %f\n", iter, res);
+            }
+            if (res <= options.tol)
+            {
+                break;
+            }
+        }  // end if
+
+        // [D]:New direction
+        scale(n, diag.data(), r.data(), z.data(), pool);
+        const double rz_next = parallel_dot(n, r.data(), z.data(), pool);
+        axpby(n, 1.0, z.data(), rz_next / rz, p.data(), pool);
+        rz = rz_next;
+    }  // end while
+
+    std::copy(x_vec.begin(), x_vec.end(), x.begin());
+    result.iterations = iter;
+    result.residual = res;
+    result.converged = res <= options.tol;
+    return result;
+}
+
+}  // namespace host
+}  // namespace clp
@@ -0,0 +1,159 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Native Host Backend
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Native C++ versions of the OpenCL kernels (add arrays, CSR products	*
+ * 	and Jacobi sweeps, residual and dot reductions, GEMM) and of the	*
+ * 	Jacobi and CG solvers built on them, threaded on the host			*
+ * 	ThreadPool with work stealing. Nothing here needs an OpenCL			*
+ * 	platform: the binaries fall back to this backend when none is		*
+ * 	found (see select_backend in cl_runtime.h), and it is the hand-		*
+ * 	threaded reference to weigh the OpenCL overhead against.			*
+ *																		*
+ * 	Vector work is cut into tasks of kTaskItems entries, a whole number	*
+ * 	of cache lines; arrays in an AlignedVector start on a line, so no	*
+ * 	two threads ever write the same line. Reductions keep one partial	*
+ * 	per task and add them in task order, so the result does not depend	*
+ * 	on the thread count or on which thread stole what.					*
+ ************************************************************************/
+
+#ifndef CXX_HOST_KERNELS_H
+#define CXX_HOST_KERNELS_H
+
+#include "cl_cg_solver.h"
+#include "cl_jacobi_solver.h"
+#include "cl_sparse.h"
+#include "host_thread_pool.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace clp
+{
+namespace host
+{
+
+// Entries of a vector task and rows of a sparse task (both multiples of
+// 	a cache line of doubles)
+constexpr int kTaskItems = 4096;
+constexpr int kTaskRows = 1024;
+
+/************************************************************************
+ * Aligned Storage														*
+ ************************************************************************/
+
+template <typename T>
+struct CacheLineAllocator
+{
+    using value_type = T;
+
+    CacheLineAllocator() = default;
+    template <typename U>
+    CacheLineAllocator(const CacheLineAllocator<U>&)
+    {
+    }
+
+    T* allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(kCacheLine))); }
+    void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t(kCacheLine)); }
+};
+
+template <typename T, typename U>
+bool operator==(const CacheLineAllocator<T>&, const CacheLineAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const CacheLineAllocator<T>&, const CacheLineAllocator<U>&)
+{
+    return false;
+}
+
+// Vector whose data starts on a cache line
+template <typename T>
+using AlignedVector = std::vector<T, CacheLineAllocator<T>>;
+
+/************************************************************************
+ * Kernels																*
+ ************************************************************************/
+
+// ||b - Ax||_inf and ||b - Ax||_2
+struct Norms
+{
+    double inf = 0.0;
+    double two = 0.0;
+
+    double get(Norm norm) const { return norm == Norm::Inf ? inf : two; }
+};
+
+// c = a + b
+template <typename T>
+void add_arrays(int n, const T* a, const T* b, T* c, ThreadPool& pool = ThreadPool::instance())
+{
+    pool.parallel_for_stealing(
+        n,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; i++)
+            {
+                c[i] = a[i] + b[i];
+            }  // end i
+        },
+        kTaskItems,
+        cache_line_items<T>());
+}
+
+// y = A x
+void spmv_csr(const CsrMatrix& A, const double* x, double* y, ThreadPool& pool = ThreadPool::instance());
+
+// x_next = D^-1 (b - (A - D) x), the cl_jacobi_csr sweep
+void jacobi_sweep_csr(const CsrMatrix& A,
+                      const double* b,
+                      const double* x,
+                      double* x_next,
+                      ThreadPool& pool = ThreadPool::instance());
+
+// Both norms of b - Ax in one pass
+Norms residual_csr(const CsrMatrix& A, const double* b, const double* x, ThreadPool& pool = ThreadPool::instance());
+
+// x . y
+double parallel_dot(int n, const double* x, const double* y, ThreadPool& pool = ThreadPool::instance());
+
+// host::gemm (host_blas.h) split over row blocks of C
+void parallel_gemm(int m,
+                   int n,
+                   int k,
+                   double alpha,
+                   const double* A,
+                   int lda,
+                   const double* B,
+                   int ldb,
+                   double beta,
+                   double* C,
+                   int ldc,
+                   ThreadPool& pool = ThreadPool::instance());
+
+/************************************************************************
+ * Solvers																*
+ ************************************************************************/
+
+// Jacobi on the host; options.method must be Jacobi. x holds the initial
+// 	guess and receives the solution
+SolveResult jacobi_solve(const CsrMatrix& A,
+                         const std::vector<double>& b,
+                         std::vector<double>& x,
+                         const JacobiOptions& options = JacobiOptions(),
+                         ThreadPool& pool = ThreadPool::instance());
+
+// Diagonally preconditioned CG on the host
+SolveResult cg_solve(const CsrMatrix& A,
+                     const std::vector<double>& b,
+                     std::vector<double>& x,
+                     const CgOptions& options = CgOptions(),
+                     ThreadPool& pool = ThreadPool::instance());
+
+}  // namespace host
+}  // namespace clp
+
+#endif  // CXX_HOST_KERNELS_H
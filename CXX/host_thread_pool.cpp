@@ -0,0 +1,245 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Host Thread Pool
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "host_thread_pool.h"
+#include <algorithm>
+#include <stdlib.h>
+
+namespace clp
+{
+namespace host
+{
+namespace
+{
+
+int default_threads()
+{
+    const char* value = getenv("CLP_HOST_THREADS");
+    if (value && atoi(value) > 0)
+    {
+        return atoi(value);
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// [begin, end) of chunk c when [0, n) is cut into "chunks" near-equal parts
+void chunk_range(int n, int chunks, int c, int& begin, int& end)
+{
+    const int base = n / chunks;
+    const int extra = n % chunks;
+    begin = c * base + std::min(c, extra);
+    end = begin + base + (c < extra ? 1 : 0);
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(int threads)
+{
+    if (threads <= 0)
+    {
+        threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    for (int t = 1; t < threads; t++)
+    {
+        workers_.emplace_back(&ThreadPool::worker, this, t);
+    }  // end t
+    runs_.reset(new Run[threads]);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& thread : workers_)
+    {
+        thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool pool(default_threads());
+    return pool;
+}
+
+void ThreadPool::parallel_for(int n, const std::function<void(int, int)>& fn, int min_chunk)
+{
+    if (n <= 0)
+    {
+        return;
+    }
+
+    // [A]:Small ranges stay on the calling thread
+    const int chunks = std::min(size(), std::max(1, n / std::max(1, min_chunk)));
+    if (chunks == 1)
+    {
+        fn(0, n);
+        return;
+    }
+
+    // [B]:Publish the task; workers with index < chunks pick up a chunk
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &fn;
+        n_ = n;
+        chunks_ = chunks;
+        grain_ = 0;
+        pending_ = chunks - 1;
+        generation_++;
+    }
+    wake_.notify_all();
+
+    // [C]:The caller runs chunk 0, then waits for the rest
+    int begin, end;
+    chunk_range(n, chunks, 0, begin, end);
+    fn(begin, end);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0; });
+    task_ = nullptr;
+}
+
+void ThreadPool::parallel_for_stealing(int n, const std::function<void(int, int)>& fn, int grain, int align)
+{
+    if (n <= 0)
+    {
+        return;
+    }
+
+    // [A]:Tasks of whole "align" blocks; one thread per task at most
+    align = std::max(1, align);
+    grain = (std::max(1, grain) + align - 1) / align * align;
+    const int tasks = (n + grain - 1) / grain;
+    const int threads = std::min(size(), tasks);
+    if (threads == 1)
+    {
+        // Still one call per task: reductions keep one partial per task
+        for (int begin = 0; begin < n; begin += grain)
+        {
+            fn(begin, std::min(begin + grain, n));
+        }  // end begin
+        return;
+    }
+
+    // [B]:Every thread owns a contiguous run of tasks to start with
+    for (int t = 0; t < threads; t++)
+    {
+        std::lock_guard<std::mutex> lock(runs_[t].mutex);
+        chunk_range(tasks, threads, t, runs_[t].next, runs_[t].end);
+    }  // end t
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &fn;
+        n_ = n;
+        chunks_ = threads;
+        grain_ = grain;
+        pending_ = threads - 1;
+        generation_++;
+    }
+    wake_.notify_all();
+
+    // [C]:The caller drains run 0, then waits for the rest
+    drain(0, fn, n, grain, threads);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0; });
+    task_ = nullptr;
+}
+
+void ThreadPool::drain(int index, const std::function<void(int, int)>& fn, int n, int grain, int threads)
+{
+    Run& own = runs_[index];
+    for (;;)
+    {
+        // [A]:Next task of the own run
+        int task = -1;
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.next < own.end)
+            {
+                task = own.next++;
+            }
+        }
+        if (task >= 0)
+        {
+            fn(task * grain, std::min(n, (task + 1) * grain));
+            continue;
+        }
+
+        // [B]:Steal the back half of the first non-empty run after ours;
+        // 	done once every run is empty
+        int first = 0;
+        int last = 0;
+        for (int v = 1; v < threads && first == last; v++)
+        {
+            Run& victim = runs_[(index + v) % threads];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            const int left = victim.end - victim.next;
+            if (left > 0)
+            {
+                last = victim.end;
+                victim.end -= (left + 1) / 2;
+                first = victim.end;
+            }
+        }  // end v
+        if (first == last)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.next = first;
+        own.end = last;
+    }  // end for
+}
+
+void ThreadPool::worker(int index)
+{
+    unsigned long seen = 0;
+    for (;;)
+    {
+        const std::function<void(int, int)>* task;
+        int n, chunks, grain;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_)
+            {
+                return;
+            }
+            seen = generation_;
+            if (index >= chunks_)
+            {
+                continue;
+            }
+            task = task_;
+            n = n_;
+            chunks = chunks_;
+            grain = grain_;
+        }
+
+        if (grain > 0)
+        {
+            drain(index, *task, n, grain, chunks);
+        }
+        else
+        {
+            int begin, end;
+            chunk_range(n, chunks, index, begin, end);
+            (*task)(begin, end);
+        }  // end if
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_--;
+        }
+        done_.notify_one();
+    }  // end for
+}
+
+}  // namespace host
+}  // namespace clp
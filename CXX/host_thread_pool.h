@@ -0,0 +1,104 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Host Thread Pool
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+/************************************************************************
+ * Small persistent pool for the host side of the hybrid solvers (e.g.	*
+ * 	the LU panel factorization). Workers are started once and sleep		*
+ * 	between calls, so a parallel_for costs a wake up rather than a		*
+ * 	thread start. parallel_for_stealing balances uneven work (sparse	*
+ * 	rows, ragged tails) by letting idle threads steal tasks, with task	*
+ * 	boundaries on whole cache lines.									*
+ *																		*
+ * 	CLP_HOST_THREADS  threads used by ThreadPool::instance() (default	*
+ * 					  std::thread::hardware_concurrency())				*
+ ************************************************************************/
+
+#ifndef CXX_HOST_THREAD_POOL_H
+#define CXX_HOST_THREAD_POOL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace clp
+{
+namespace host
+{
+
+// Bytes per cache line assumed by the partitioning
+constexpr std::size_t kCacheLine = 64;
+
+// Items of T per cache line, e.g. 8 doubles
+template <typename T>
+constexpr int cache_line_items()
+{
+    return static_cast<int>(std::max<std::size_t>(1, kCacheLine / sizeof(T)));
+}
+
+class ThreadPool
+{
+  public:
+    // threads counts the calling thread; 0 or less means one per core
+    explicit ThreadPool(int threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Process-wide pool sized from CLP_HOST_THREADS
+    static ThreadPool& instance();
+
+    int size() const { return static_cast<int>(workers_.size()) + 1; }
+
+    // Calls fn(begin, end) on contiguous chunks covering [0, n), one chunk
+    // 	per thread (the caller runs the first), and returns when all are
+    // 	done. Ranges shorter than min_chunk per thread use fewer threads.
+    // 	Not reentrant: fn must not call parallel_for on the same pool
+    void parallel_for(int n, const std::function<void(int, int)>& fn, int min_chunk = 1);
+
+    // Work-stealing variant: [0, n) is cut into tasks of "grain" items,
+    // 	rounded up to a multiple of "align", and every thread starts on its
+    // 	own contiguous run of tasks; a thread that drains its run steals
+    // 	the back half of another's. With align = cache_line_items<T>() and
+    // 	a line-aligned array no two threads write the same cache line.
+    // 	fn(begin, end) is called once per task, so it must not assume one
+    // 	call per thread. Not reentrant either
+    void parallel_for_stealing(int n, const std::function<void(int, int)>& fn, int grain, int align = 1);
+
+  private:
+    // Tasks [next, end) still owned by one thread, on its own cache line
+    struct alignas(kCacheLine) Run
+    {
+        std::mutex mutex;
+        int next = 0;
+        int end = 0;
+    };
+
+    void worker(int index);
+    void drain(int index, const std::function<void(int, int)>& fn, int n, int grain, int threads);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(int, int)>* task_ = nullptr;
+    int n_ = 0;
+    int chunks_ = 0;
+    int pending_ = 0;
+    int grain_ = 0;  // Items per task; 0 for the static parallel_for
+    unsigned long generation_ = 0;
+    bool stop_ = false;
+    std::unique_ptr<Run[]> runs_;  // One per thread
+};
+
+}  // namespace host
+}  // namespace clp
+
+#endif  // CXX_HOST_THREAD_POOL_H
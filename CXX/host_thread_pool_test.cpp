@@ -0,0 +1,168 @@
+// Alejandro Valencia
+// OpenCL C++ Projects: Host Thread Pool Tests
+// Start: 18 October, 2026
+// Update: 18 October, 2026
+
+#include "host_kernels.h"
+#include "host_thread_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+const int kThreads[] = {1, 2, 3, 4, 7, 8};
+
+// Every (begin, end) call of one parallel_for_stealing, with a visit count
+// 	per index
+struct Coverage
+{
+    explicit Coverage(int n) : visits(n) {}
+
+    void operator()(int begin, int end)
+    {
+        for (int i = begin; i < end; i++)
+        {
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+        }  // end i
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.emplace_back(begin, end);
+    }
+
+    std::vector<std::atomic<int>> visits;
+    std::mutex mutex;
+    std::vector<std::pair<int, int>> tasks;
+};
+
+// x_i = sin(i) + 2, a vector without a pattern the reductions could hide
+std::vector<double> test_vector(int n)
+{
+    std::vector<double> x(n);
+    for (int i = 0; i < n; i++)
+    {
+        x[i] = std::sin(static_cast<double>(i)) + 2.0;
+    }  // end i
+    return x;
+}
+
+}  // namespace
+
+/************************************************************************
+ * Scheduling															*
+ ************************************************************************/
+
+TEST(ThreadPoolTest, StealingVisitsEveryIndexOnce)
+{
+    for (int threads : kThreads)
+    {
+        clp::host::ThreadPool pool(threads);
+        for (int n : {0, 1, 7, 64, 1000, 10007})
+        {
+            for (int grain : {1, 3, 8, 64, 1000})
+            {
+                for (int align : {1, 8})
+                {
+                    SCOPED_TRACE(::testing::Message()
+                                 << "threads " << threads << ", n " << n << ", grain " << grain << ", align " << align);
+                    Coverage coverage(n);
+                    pool.parallel_for_stealing(
+                        n, [&](int begin, int end) { coverage(begin, end); }, grain, align);
+
+                    for (int i = 0; i < n; i++)
+                    {
+                        ASSERT_EQ(coverage.visits[i].load(), 1) << "index " << i;
+                    }  // end i
+                    for (const auto& task : coverage.tasks)
+                    {
+                        EXPECT_LT(task.first, task.second);
+                        EXPECT_EQ(task.first % align, 0) << "task [" << task.first << ", " << task.second << ")";
+                        EXPECT_TRUE(task.second % align == 0 || task.second == n)
+                            << "task [" << task.first << ", " << task.second << ")";
+                    }  // end task
+                }  // end align
+            }  // end grain
+        }  // end n
+    }  // end threads
+}
+
+TEST(ThreadPoolTest, StealingReusesThePool)
+{
+    // Back-to-back calls on one pool must not leak tasks into each other
+    clp::host::ThreadPool pool(4);
+    for (int call = 0; call < 200; call++)
+    {
+        const int n = 1 + 37 * call;
+        Coverage coverage(n);
+        pool.parallel_for_stealing(
+            n, [&](int begin, int end) { coverage(begin, end); }, 16, 8);
+        for (int i = 0; i < n; i++)
+        {
+            ASSERT_EQ(coverage.visits[i].load(), 1) << "call " << call << ", index " << i;
+        }  // end i
+    }  // end call
+}
+
+TEST(ThreadPoolTest, StaticChunksVisitEveryIndexOnce)
+{
+    for (int threads : kThreads)
+    {
+        clp::host::ThreadPool pool(threads);
+        for (int n : {0, 1, 5, 1000})
+        {
+            Coverage coverage(n);
+            pool.parallel_for(n, [&](int begin, int end) { coverage(begin, end); });
+            for (int i = 0; i < n; i++)
+            {
+                ASSERT_EQ(coverage.visits[i].load(), 1) << "threads " << threads << ", n " << n << ", index " << i;
+            }  // end i
+        }  // end n
+    }  // end threads
+}
+
+/************************************************************************
+ * Reductions															*
+ ************************************************************************/
+
+// Partials are added in task order, so the thread count must not change a
+// 	single bit of the result
+TEST(ThreadPoolTest, ReductionsDoNotDependOnThreadCount)
+{
+    const clp::CsrMatrix A = clp::poisson2d_csr(151, 101);
+    const int n = A.rows;
+    const std::vector<double> x = test_vector(n);
+    const std::vector<double> b(n, 1.0);
+
+    clp::host::ThreadPool serial(1);
+    const clp::host::Norms reference = clp::host::residual_csr(A, b.data(), x.data(), serial);
+    const double dot_reference = clp::host::parallel_dot(n, x.data(), b.data(), serial);
+
+    // Against a plain loop, to rounding
+    std::vector<double> Ax(n);
+    clp::spmv(A, x.data(), Ax.data());
+    double inf = 0.0, sq = 0.0, dot = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        inf = std::max(inf, std::fabs(b[i] - Ax[i]));
+        sq += (b[i] - Ax[i]) * (b[i] - Ax[i]);
+        dot += x[i] * b[i];
+    }  // end i
+    EXPECT_DOUBLE_EQ(reference.inf, inf);
+    EXPECT_NEAR(reference.two, std::sqrt(sq), 1e-12 * std::sqrt(sq));
+    EXPECT_NEAR(dot_reference, dot, 1e-12 * dot);
+
+    for (int threads : kThreads)
+    {
+        clp::host::ThreadPool pool(threads);
+        for (int repeat = 0; repeat < 5; repeat++)
+        {
+            const clp::host::Norms norms = clp::host::residual_csr(A, b.data(), x.data(), pool);
+            EXPECT_EQ(norms.inf, reference.inf) << "threads " << threads;
+            EXPECT_EQ(norms.two, reference.two) << "threads " << threads;
+            EXPECT_EQ(clp::host::parallel_dot(n, x.data(), b.data(), pool), dot_reference) << "threads " << threads;
+        }  // end repeat
+    }  // end threads
+}
@@ -1,7 +1,7 @@
 // Alejandro Valencia
 // My Library
 // Start: 31 October, 2018
-// Update: 25 November, 2018
+// Update: 18 October, 2026
 
 #ifndef mylib
 
@@ -290,25 +290,24 @@
      !        b: The right hand side of the matrix equation
      !        n: Number of columns
      !
+     !    NOTE: No pivoting; clp::DenseLu in cl_lu.h is the blocked, pivoted
+     !        version (solve with clp::lu_solve)
+     !
     */
 
     int UpperTri(double A[],double b[], int n){
 
         /* Declarations */
         int k,i,j; //Indicies
-
-
-        /* Set Identity Matrix */
-        double l[n*n];
-        eyes(l,n);
+        double l;  //Multiplier of row k (one at a time, no n x n stack array)
 
         /* Main Algorithm */
         for (k = 0; k < n - 1 ; k++) {
             for (i = k + 1; i < n; i++) {
-                l[k + n*i] = A[k + n*i] / A[k + n*k];
-                b[i] = b[i] - (l[k + n*i] * b[k]);
+                l = A[k + n*i] / A[k + n*k];
+                b[i] = b[i] - (l * b[k]);
                     for (j = k ; j < n; j++) {
-                        A[j + n*i] = A[j+n*i] - (l[k+n*i] * A[j+n*k]);
+                        A[j + n*i] = A[j+n*i] - (l * A[j+n*k]);
                     }// end for j
             }// end for i
         }// end for k
@@ -333,6 +332,10 @@
      !        b: The right hand side of the matrix equation (column n x 1)
      !        n: The number of columns/rows of A
      !
+     !   NOTE: clp::host::trsv_upper in host_blas.h is the vectorized version;
+     !       for many right-hand sides use clp::host::trsm_upper, or
+     !       clp::DenseTriangularSolver (cl_triangular.h) on the device
+     !
     */
 
     int backsub(double A[], double x[], double b[],int n){
@@ -375,6 +378,10 @@
      !        b: The right hand side of the matrix equation (column n x 1)
      !        n: The number of columns/rows of A
      !
+     !   NOTE: clp::host::trsv_lower in host_blas.h is the vectorized version;
+     !       for many right-hand sides use clp::host::trsm_lower, or
+     !       clp::DenseTriangularSolver (cl_triangular.h) on the device
+     !
     */
 
     int forwardsub(double A[], double x[], double b[], int n){
@@ -422,6 +429,9 @@
      !       U: Upper diagonal matrix
      !       n: Number of rows/columns
      !
+     !   NOTE: clp::host::lu_inplace in host_blas.h is the vectorized version;
+     !       clp::DenseLu in cl_lu.h adds partial pivoting and blocking
+     !
     */
 
     int Doolittle(double A[], double L[], double U[], int n){
@@ -581,6 +591,8 @@
      !       B:  Matrix 2 with size n x p
      !       C:  Resultant with size m x p
      !
+     !   NOTE: clp::host::gemm in host_blas.h is the vectorized version
+     !
     */
 
     int matmult(double A[], double B[], double C[],int m, int n, int p){
@@ -598,9 +610,9 @@
 
                 }//end k
 
-            }//end j
+                C[j+p*i] = sum;
 
-            C[(j-1)+p*i] = sum;
+            }//end j
 
         }//end i
 
@@ -12,11 +12,15 @@ os.environ["PYOPENCL_COMPILER_OUTPUT"] = "1"
 # ***********************************************************************/
 
 # OpenCL is based on the vectorization of the problem
-# Assign Values
-U = np.array([(3, 2, 3), (0, 4, 5), (0, 0, 6)]).astype(np.float32)
-y = np.array([7, 8, 9]).astype(np.float32).reshape([3, 1])
-result = y.copy().astype(np.float32)
-n = len(U)
+# Assign Values. U is upper triangular and every column of y is one right
+#   hand side; all of them are solved together
+n = 512  # Rows/columns of U
+nrhs = 4  # Right-hand sides
+block = 64  # Rows per diagonal block
+rng = np.random.default_rng(2026)
+U = np.triu(rng.uniform(-1, 1, (n, n)) / np.sqrt(n)) + np.diag(rng.uniform(2, 3, n))
+y = rng.uniform(-1, 1, (n, nrhs))
+result = y.copy()
 
 # // Start Clock //
 start = time.time()
@@ -49,70 +53,76 @@ cxt = cl.Context([device[0]])
 queue = cl.CommandQueue(cxt)
 
 
-# [D]:Create Kernel to be Executed
-prg = cl.Program(
-    cxt,
-    """
-    __kernel void backsub(
-    int n, int j, __global const float *U, __global float *result)
-    {
-        //[A]:Get Global ID Values
-        int gid  = get_global_id(0); // Row number of result
-
-        //[B]:Compute result @ Global ID (gid)
-        result[gid] = result[gid] - U[j + n*gid]*result[j];
-
-    }//end kernel
-""",
-).build()
-
-
-# [E]:Deploy Kernel for Device Execution
-# The following lines associate the arguments to the kernel and deploys
-#   it for device execution by calling the method that PyOpenCL generates
-#   in program with the built kernel name: backsub. Because back substi
-#   tution can only parallelize the subtraction of the elements of U, we
-#   loop through the number of columns in main program. Pre-assign the
-#   memory flags and kernel variable.
-#
-mem_flags = cl.mem_flags
-krnl = prg.backsub
-
-for j in range(n - 1, n - 4, -1):
-    # Calculate answer and set U @ j,j to 0
-    result[j] = result[j] / U[j, j]
-    U[j, j] = 0
-
-    # [F]:Create Buffers
-    # Allocate device memory and move input data from the host to the device
-    #   memory. Also create a buffer for the "result". Note U is static and
-    #   will not change during kernel execution. We denote the memory flag
-    #   as READ_ONLY. "result" will be both read and written to by OpenCL
-    #   device and therefore uses the READ_WRITE memory flag
-    #
-    U_buf = cl.Buffer(cxt, mem_flags.READ_ONLY | mem_flags.COPY_HOST_PTR, hostbuf=U)
-    result_buffer = cl.Buffer(cxt, mem_flags.READ_WRITE | mem_flags.COPY_HOST_PTR, hostbuf=result)
-
-    # [G] Set Kernel Arguments
-    # For arguments that are numpy arrays enter the created buffers
-    krnl.set_args(np.int32(n), np.int32(j), U_buf, result_buffer)
-
-    # [H] Execute Kernel and Copy Result to Global Memory
-    # The previously created queue is the first argument followed by
-    #   kernel arguments, the shape of the resulting vector. When the
-    #   Kernel is finsihed being executed the data stored in the result
-    #   buffer will be copied into the result variable
-    cl.enqueue_nd_range_kernel(queue, krnl, result.shape, None)
-    cl.enqueue_copy(queue, result, result_buffer)
-
-# end j
+# [D]:Build the Kernels
+# The blocked triangular solve kernels are shared with the C++ solvers
+#   (CXX/cl_triangular.cl): cl_trsm_diag solves one diagonal block with a
+#   work-group per right-hand side, cl_trsm_update removes the solved block
+#   from the rows above it (a GEMV per right-hand side)
+kernel_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "CXX", "cl_triangular.cl")
+with open(kernel_path) as source:
+    prg = cl.Program(cxt, source.read()).build()
+diag = prg.cl_trsm_diag
+update = prg.cl_trsm_update
+block = min(block, diag.get_work_group_info(cl.kernel_work_group_info.WORK_GROUP_SIZE, device[0]))
+
 
+# [E]:Create Buffers
+# U and the right-hand sides are copied once; result is solved in place
+mem_flags = cl.mem_flags
+U_buf = cl.Buffer(cxt, mem_flags.READ_ONLY | mem_flags.COPY_HOST_PTR, hostbuf=U)
+result_buffer = cl.Buffer(cxt, mem_flags.READ_WRITE | mem_flags.COPY_HOST_PTR, hostbuf=result)
+
+
+# [F]:Deploy Kernels, Last Block First
+# Back substitution is serial from block to block, but each block is solved
+#   by a work-group and the update of everything above it is one launch
+for done in range(0, n, block):
+    k0 = max(0, n - done - block)
+    nb = n - done - k0
+
+    diag.set_args(
+        np.int32(nb),
+        np.int32(1),
+        np.int32(0),
+        U_buf,
+        np.int32(k0 + n * k0),
+        np.int32(n),
+        result_buffer,
+        np.int32(nrhs * k0),
+        np.int32(nrhs),
+        cl.LocalMemory(8 * block),
+    )
+    cl.enqueue_nd_range_kernel(queue, diag, (block, nrhs), (block, 1))
+
+    if k0 > 0:
+        update.set_args(
+            np.int32(k0),
+            np.int32(nrhs),
+            np.int32(nb),
+            U_buf,
+            np.int32(k0),
+            np.int32(n),
+            result_buffer,
+            np.int32(nrhs * k0),
+            result_buffer,
+            np.int32(0),
+            np.int32(nrhs),
+        )
+        cl.enqueue_nd_range_kernel(queue, update, (k0, nrhs), None)
+
+# end done
+
+
+# [G]:Copy Result Back to the Host
+cl.enqueue_copy(queue, result, result_buffer)
+queue.finish()
 
 # // Stop Clock //
 end = time.time()
 totaltime = end - start
 print("Executed Time = %2.3f" % totaltime)
 
-# print("result for 1 OpenCL job")
-print(result)
+# Compare with numpy
+print("max |error| = %e" % np.max(np.abs(result - la.solve(U, y))))
+print(result[:4])
 print("success")